@@ -0,0 +1,324 @@
+// 📈 BENCHMARK DE L'ÉCOSYSTÈME À GRANDE ÉCHELLE
+// Peuple Ecosystem avec 1k à 1M entités selon plusieurs mélanges
+// herbivores / carnivores / plantes, puis mesure séparément chaque phase de
+// Update (reproduction, recyclage des morts, statistiques...) et le rendu
+// vers une cible hors écran. Les résultats sortent en JSON pour suivre les
+// régressions d'une version à l'autre ; un tableau lisible va sur stderr.
+//
+// Options : --output fichier.json  --threads N  --ticks N  --max-entities N
+// Compilé avec -DECOSYSTEM_HEADLESS_ONLY, le rendu n'est pas mesuré (pas de SDL).
+// Les phases viennent du profileur de l'écosystème : ne pas compiler avec -DECOSYSTEM_PROFILE=0.
+#include "Core/Ecosystem.h"
+#include "Core/LifeCycleKernels.h"
+#ifndef ECOSYSTEM_HEADLESS_ONLY
+#include <SDL3/SDL.h>
+#include "Graphics/Camera.h"
+#include "Graphics/Renderer.h"
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Ecosystem::Core;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// Surface moyenne par entité (px²), comme SpatialGridBench : densité constante
+constexpr float AreaPerEntity = 2500.0f;
+constexpr float TickDuration = 1.0f / 60.0f;
+constexpr uint64_t BenchSeed = 1;
+constexpr double TimeBudgetMs = 3000.0;     // Par configuration, hors initialisation
+constexpr int MinimumTicks = 3;
+constexpr int RenderFrames = 10;
+constexpr int ViewWidth = 1280;
+constexpr int ViewHeight = 720;
+
+// 🧪 MÉLANGES DE POPULATION (parts en pourcentage)
+struct Mix {
+    const char* name;
+    int herbivores;
+    int carnivores;
+    int plants;
+};
+
+constexpr Mix Mixes[] = {
+    {"equilibre", 60, 10, 30},
+    {"herbivores", 80, 5, 15},
+    {"predateurs", 45, 25, 30},
+    {"plantes", 15, 5, 80},
+};
+
+constexpr int EntityCounts[] = {1000, 10000, 100000, 1000000};
+
+struct Options {
+    const char* outputPath = nullptr;       // nullptr = sortie standard
+    int threads = 1;
+    int ticks = 50;
+    int maxEntities = 1000000;
+};
+
+// Moyenne et minimum d'une série de mesures (ms)
+struct Sample {
+    double total = 0.0;
+    double minimum = 0.0;
+    int count = 0;
+
+    void Add(double ms) {
+        minimum = (count == 0) ? ms : std::min(minimum, ms);
+        total += ms;
+        ++count;
+    }
+    double Average() const { return count > 0 ? total / count : 0.0; }
+};
+
+struct Result {
+    int entities;
+    const Mix* mix;
+    int ticks;
+    int finalEntities;
+    double initializeMs;
+    Sample update;
+    Sample removeDead;
+    Sample updateEntities;
+    Sample spatialIndex;
+    Sample behaviors;
+    Sample eating;
+    Sample reproduction;
+    Sample plantGrowth;
+    Sample statistics;
+    bool rendered;
+    Sample renderWorld;         // Monde entier à l'écran : pire cas, aucun culling
+    Sample renderView;          // Fenêtre au zoom 1 au centre du monde
+    int renderWorldQuads;
+    int renderViewQuads;
+};
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+#ifndef ECOSYSTEM_HEADLESS_ONLY
+// 🖼 CIBLE HORS ÉCRAN : rendu logiciel dans une surface, sans fenêtre
+class OffscreenTarget {
+public:
+    OffscreenTarget()
+        : mSurface(SDL_CreateSurface(ViewWidth, ViewHeight, SDL_PIXELFORMAT_RGBA32)),
+          mRenderer(mSurface ? SDL_CreateSoftwareRenderer(mSurface) : nullptr) {
+        if (!mRenderer) {
+            std::fprintf(stderr, "⚠ Rendu hors écran indisponible: %s\n", SDL_GetError());
+        }
+        mDrawer.Initialize(mRenderer);
+    }
+    ~OffscreenTarget() {
+        if (mRenderer) SDL_DestroyRenderer(mRenderer);
+        if (mSurface) SDL_DestroySurface(mSurface);
+    }
+
+    bool IsValid() const { return mRenderer != nullptr; }
+
+    // Une image complète : effacement, lot de quads, rastérisation forcée
+    double DrawFrame(const Ecosystem::Core::RenderFrame& world, const Ecosystem::Graphics::Camera& camera) {
+        auto start = Clock::now();
+        SDL_SetRenderDrawColor(mRenderer, 20, 20, 30, 255);
+        SDL_RenderClear(mRenderer);
+        mDrawer.DrawEcosystem(world, camera);
+        SDL_FlushRenderer(mRenderer);
+        return ElapsedMs(start);
+    }
+    int GetLastQuadCount() const { return mDrawer.GetLastQuadCount(); }
+
+private:
+    SDL_Surface* mSurface;
+    SDL_Renderer* mRenderer;
+    Ecosystem::Graphics::Renderer mDrawer;
+};
+
+void MeasureRender(OffscreenTarget& target, const Ecosystem::Core::Ecosystem& world, Result& result) {
+    if (!target.IsValid()) return;
+    // Image figée de la zone vue, comme celle que le thread de simulation publie (copie hors mesure)
+    Ecosystem::Core::RenderFrame frameData;
+    auto capture = [&](const Ecosystem::Graphics::Camera& view) {
+        const Ecosystem::Graphics::Camera::Rect visible = view.GetVisibleRect(24.0f);
+        frameData.Capture(world, {visible.minX, visible.minY, visible.maxX, visible.maxY});
+    };
+    Ecosystem::Graphics::Camera camera(static_cast<float>(ViewWidth), static_cast<float>(ViewHeight));
+
+    camera.FitWorld(world.GetWorldWidth(), world.GetWorldHeight());
+    capture(camera);
+    for (int frame = 0; frame < RenderFrames; ++frame) {
+        result.renderWorld.Add(target.DrawFrame(frameData, camera));
+    }
+    result.renderWorldQuads = target.GetLastQuadCount();
+
+    camera.CenterOn(Vector2D(world.GetWorldWidth() * 0.5f, world.GetWorldHeight() * 0.5f));
+    camera.ZoomAt(1.0f / camera.GetZoom(), Vector2D(ViewWidth * 0.5f, ViewHeight * 0.5f));
+    capture(camera);
+    for (int frame = 0; frame < RenderFrames; ++frame) {
+        result.renderView.Add(target.DrawFrame(frameData, camera));
+    }
+    result.renderViewQuads = target.GetLastQuadCount();
+    result.rendered = true;
+}
+#endif
+
+// ⏱ UNE CONFIGURATION : initialisation, ticks jusqu'au budget, rendu
+Result Measure(int entityCount, const Mix& mix, const Options& options) {
+    Result result{};
+    result.entities = entityCount;
+    result.mix = &mix;
+
+    const float side = std::sqrt(entityCount * AreaPerEntity);
+    Ecosystem::Core::Ecosystem world(side, side, entityCount + entityCount / 2, options.threads);
+    world.SetSeed(BenchSeed);
+
+    auto start = Clock::now();
+    world.Initialize(entityCount * mix.herbivores / 100, entityCount * mix.carnivores / 100,
+                     entityCount * mix.plants / 100);
+    result.initializeMs = ElapsedMs(start);
+
+    // Un tick d'échauffement : caches, pages des tableaux, threads réveillés
+    world.Update(TickDuration);
+
+    auto runStart = Clock::now();
+    while (result.ticks < options.ticks &&
+           (result.ticks < MinimumTicks || ElapsedMs(runStart) < TimeBudgetMs)) {
+        auto tickStart = Clock::now();
+        world.Update(TickDuration);
+        result.update.Add(ElapsedMs(tickStart));
+
+        const Profiler& profiler = world.GetProfiler();
+        result.removeDead.Add(profiler.GetLastMs(ProfilePhase::RemoveDeadEntities));
+        result.updateEntities.Add(profiler.GetLastMs(ProfilePhase::UpdateEntities));
+        result.spatialIndex.Add(profiler.GetLastMs(ProfilePhase::SpatialIndex));
+        result.behaviors.Add(profiler.GetLastMs(ProfilePhase::Behaviors));
+        result.eating.Add(profiler.GetLastMs(ProfilePhase::Eating));
+        result.reproduction.Add(profiler.GetLastMs(ProfilePhase::Reproduction));
+        result.plantGrowth.Add(profiler.GetLastMs(ProfilePhase::PlantGrowth));
+        result.statistics.Add(profiler.GetLastMs(ProfilePhase::Statistics));
+        ++result.ticks;
+    }
+    result.finalEntities = world.GetEntityCount();
+
+#ifndef ECOSYSTEM_HEADLESS_ONLY
+    static OffscreenTarget target;
+    MeasureRender(target, world, result);
+#endif
+    return result;
+}
+
+// 📝 SORTIE JSON
+void WriteSample(FILE* output, const char* name, const Sample& sample, bool last = false) {
+    std::fprintf(output, "        \"%s\": {\"avg_ms\": %.6f, \"min_ms\": %.6f}%s\n",
+                 name, sample.Average(), sample.minimum, last ? "" : ",");
+}
+
+void WriteJson(FILE* output, const Options& options, const std::vector<Result>& results) {
+    std::fprintf(output, "{\n");
+    std::fprintf(output, "  \"benchmark\": \"ecosystem_update\",\n");
+    std::fprintf(output, "  \"schema\": 1,\n");
+    std::fprintf(output, "  \"timestamp\": %lld,\n", static_cast<long long>(std::time(nullptr)));
+    std::fprintf(output, "  \"seed\": %llu,\n", static_cast<unsigned long long>(BenchSeed));
+    std::fprintf(output, "  \"threads\": %d,\n", options.threads);
+    std::fprintf(output, "  \"simd\": \"%s\",\n",
+                 LifeCycleKernels::GetName(LifeCycleKernels::GetActive()));
+    std::fprintf(output, "  \"tick_seconds\": %.6f,\n", TickDuration);
+    std::fprintf(output, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        std::fprintf(output, "    {\n");
+        std::fprintf(output, "      \"entities\": %d,\n", result.entities);
+        std::fprintf(output, "      \"mix\": \"%s\",\n", result.mix->name);
+        std::fprintf(output, "      \"herbivores_pct\": %d, \"carnivores_pct\": %d, \"plants_pct\": %d,\n",
+                     result.mix->herbivores, result.mix->carnivores, result.mix->plants);
+        std::fprintf(output, "      \"ticks\": %d,\n", result.ticks);
+        std::fprintf(output, "      \"final_entities\": %d,\n", result.finalEntities);
+        std::fprintf(output, "      \"initialize_ms\": %.6f,\n", result.initializeMs);
+        std::fprintf(output, "      \"phases\": {\n");
+        WriteSample(output, "update", result.update);
+        WriteSample(output, "remove_dead_entities", result.removeDead);
+        WriteSample(output, "update_entities", result.updateEntities);
+        WriteSample(output, "spatial_index", result.spatialIndex);
+        WriteSample(output, "behaviors", result.behaviors);
+        WriteSample(output, "eating", result.eating);
+        WriteSample(output, "reproduction", result.reproduction);
+        WriteSample(output, "plant_growth", result.plantGrowth);
+        WriteSample(output, "update_statistics", result.statistics, !result.rendered);
+        if (result.rendered) {
+            WriteSample(output, "render_world", result.renderWorld);
+            WriteSample(output, "render_view", result.renderView, true);
+        }
+        std::fprintf(output, "      }");
+        if (result.rendered) {
+            std::fprintf(output, ",\n      \"render_world_quads\": %d, \"render_view_quads\": %d",
+                         result.renderWorldQuads, result.renderViewQuads);
+        }
+        std::fprintf(output, "\n    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(output, "  ]\n}\n");
+}
+
+bool ParseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--output") == 0 && hasValue) {
+            options.outputPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            options.threads = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            options.ticks = std::max(MinimumTicks, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--max-entities") == 0 && hasValue) {
+            options.maxEntities = std::atoi(argv[++i]);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--output fichier.json] [--threads N] [--ticks N] [--max-entities N]\n",
+                         argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) return 1;
+    if (!Profiler::Enabled) {
+        std::fprintf(stderr, "⚠ Profilage désactivé (ECOSYSTEM_PROFILE=0) : seul update est mesuré\n");
+    }
+
+    // Les journaux de l'écosystème faussent la mesure : sortie standard muette pendant les runs
+    std::cout.setstate(std::ios::badbit);
+
+    std::fprintf(stderr, "%9s %11s %6s %11s %11s %11s %11s %11s\n", "entites", "melange", "ticks",
+                 "update ms", "repro ms", "morts ms", "stats ms", "rendu ms");
+    std::vector<Result> results;
+    for (int entityCount : EntityCounts) {
+        if (entityCount > options.maxEntities) continue;
+        for (const Mix& mix : Mixes) {
+            results.push_back(Measure(entityCount, mix, options));
+            const Result& result = results.back();
+            char renderColumn[32] = "-";
+            if (result.rendered) std::snprintf(renderColumn, sizeof(renderColumn), "%.3f", result.renderWorld.Average());
+            std::fprintf(stderr, "%9d %11s %6d %11.3f %11.3f %11.3f %11.3f %11s\n", result.entities,
+                         mix.name, result.ticks, result.update.Average(), result.reproduction.Average(),
+                         result.removeDead.Average(), result.statistics.Average(), renderColumn);
+        }
+    }
+
+    FILE* output = options.outputPath ? std::fopen(options.outputPath, "w") : stdout;
+    if (!output) {
+        std::fprintf(stderr, "❌ Impossible d'écrire %s\n", options.outputPath);
+        return 1;
+    }
+    WriteJson(output, options, results);
+    if (output != stdout) std::fclose(output);
+    return 0;
+}
@@ -0,0 +1,103 @@
+// 📈 BENCHMARK DU STOCK DE NOURRITURE
+// Mesure, pour 10k à 500k éléments au sol, le coût d'un tick de consommation
+// (un herbivore sur dix mange puis autant de nourriture réapparaît) et d'une
+// recherche du plus proche par herbivore dans le rayon de perception.
+// Quelques requêtes sont vérifiées contre un parcours linéaire.
+#include "Core/Entity.h"
+#include "Core/FoodStore.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Ecosystem::Core;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// Surface moyenne par élément (px²) : même densité que SpatialGridBench
+constexpr float AreaPerItem = 2500.0f;
+constexpr int HerbivoresPerItem = 2;       // Requêtes par tick = éléments / 2
+constexpr int CheckedQueries = 200;
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// 🔍 RÉFÉRENCE : parcours linéaire, égalités départagées par l'indice dense comme FoodStore
+long long LinearNearest(const FoodStore& store, Vector2D center, float radius) {
+    long long best = -1;
+    float bestDistanceSquared = radius * radius;
+    const std::vector<Food>& items = store.GetItems();
+    for (size_t i = 0; i < items.size(); ++i) {
+        const float distanceSquared = (items[i].position - center).LengthSquared();
+        if (distanceSquared < bestDistanceSquared) {
+            best = static_cast<long long>(i);
+            bestDistanceSquared = distanceSquared;
+        }
+    }
+    return best;
+}
+
+void Measure(int itemCount) {
+    const float side = std::sqrt(itemCount * AreaPerItem);
+    const float radius = Entity::FoodPerceptionRadius;
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> coordinate(0.0f, side);
+
+    // 1. Remplissage
+    FoodStore store(side, side, Entity::PredatorPerceptionRadius);
+    store.Reserve(itemCount);
+    std::vector<FoodHandle> handles;
+    handles.reserve(itemCount);
+    auto start = Clock::now();
+    for (int i = 0; i < itemCount; ++i) {
+        handles.push_back(store.Add(Food(Vector2D(coordinate(generator), coordinate(generator)))));
+    }
+    const double fillMs = ElapsedMs(start);
+
+    // 2. Consommation et réapparition d'un dixième du stock
+    start = Clock::now();
+    for (int i = 0; i < itemCount / 10; ++i) {
+        FoodHandle& handle = handles[generator() % handles.size()];
+        store.Remove(handle);
+        handle = store.Add(Food(Vector2D(coordinate(generator), coordinate(generator))));
+    }
+    const double churnMs = ElapsedMs(start);
+
+    // 3. Une recherche par herbivore
+    const int queryCount = itemCount / HerbivoresPerItem;
+    std::vector<Vector2D> herbivores(queryCount);
+    for (auto& position : herbivores) {
+        position = Vector2D(coordinate(generator), coordinate(generator));
+    }
+    long long found = 0;
+    start = Clock::now();
+    for (const auto& position : herbivores) {
+        found += !store.FindNearest(position, radius).IsNull();
+    }
+    const double queryMs = ElapsedMs(start);
+
+    int mismatches = 0;
+    for (int i = 0; i < CheckedQueries && i < queryCount; ++i) {
+        const FoodHandle handle = store.FindNearest(herbivores[i], radius);
+        const long long expected = LinearNearest(store, herbivores[i], radius);
+        const bool same = expected < 0 ? handle.IsNull()
+                                       : !handle.IsNull() && store.GetHandle(static_cast<size_t>(expected)).slot == handle.slot;
+        mismatches += !same;
+    }
+
+    std::printf("%10d %12.3f %12.3f %14.3f %12.1f%% %s\n", itemCount, fillMs, churnMs, queryMs,
+                100.0 * found / queryCount, mismatches == 0 ? "ok" : "❌ différent du parcours linéaire");
+}
+
+} // namespace
+
+int main() {
+    std::printf("%10s %12s %12s %14s %13s\n", "elements", "ajout ms", "churn ms", "requetes ms", "trouves");
+    for (int itemCount : {10000, 50000, 100000, 200000, 500000}) {
+        Measure(itemCount);
+    }
+    return 0;
+}
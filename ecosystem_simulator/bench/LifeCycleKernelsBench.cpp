@@ -0,0 +1,101 @@
+// 📈 BENCHMARK DES NOYAUX DU CYCLE DE VIE
+// Mesure le coût par entité des passes énergie / âge / mouvement / morts
+// pour chaque jeu d'instructions disponible, comparé au chemin scalaire.
+// Vérifie aussi que toutes les variantes donnent des colonnes identiques au bit près.
+#include "Core/CounterRandom.h"
+#include "Core/EntityStore.h"
+#include "Core/LifeCycleKernels.h"
+#include "Core/SpeciesParameters.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace Ecosystem::Core;
+using Clock = std::chrono::steady_clock;
+using InstructionSet = LifeCycleKernels::InstructionSet;
+
+namespace {
+
+constexpr int PassesPerRun = 200;
+constexpr float TickDuration = 1.0f / 60.0f;
+
+// 🌱 POPULATION SYNTHÉTIQUE : types mélangés, quelques morts, âges et énergies variés
+void FillStore(EntityStore& store, int entityCount) {
+    store.Clear();
+    store.Reserve(entityCount);
+    CounterRandom random(42, 0, 0, RandomStream::World);
+    for (int i = 0; i < entityCount; ++i) {
+        const EntityType type = static_cast<EntityType>(random.NextUInt() % 3);
+        const Vector2D position(random.NextFloat(0.0f, 4000.0f), random.NextFloat(0.0f, 4000.0f));
+        const Vector2D velocity(random.NextFloat(-1.0f, 1.0f), random.NextFloat(-1.0f, 1.0f));
+        const size_t index = store.Add(type, position, velocity, random.NextFloat(20.0f, 200.0f), 200.0f,
+                                       150.0f, 8.0f, Color());
+        store.age[index] = random.NextFloat(0.0f, 150.0f);
+        if (random.NextFloat() < 0.05f) store.Kill(index);
+    }
+}
+
+// Empreinte des colonnes modifiées par les noyaux
+bool SameColumns(const EntityStore& a, const EntityStore& b) {
+    const size_t bytes = a.Size() * sizeof(float);
+    return std::memcmp(a.energy.data(), b.energy.data(), bytes) == 0 &&
+           std::memcmp(a.age.data(), b.age.data(), bytes) == 0 &&
+           std::memcmp(a.positionX.data(), b.positionX.data(), bytes) == 0 &&
+           std::memcmp(a.positionY.data(), b.positionY.data(), bytes) == 0;
+}
+
+// ⏱ COÛT D'UNE PASSE COMPLÈTE (ns par entité)
+double MeasurePass(EntityStore& store, LifeCycleCommands& commands, size_t& deathCount) {
+    const size_t count = store.Size();
+    const std::array<float, SpeciesCount> drain = SpeciesTable::Defaults().GetEnergyDrain();
+    deathCount = 0;
+    auto start = Clock::now();
+    for (int pass = 0; pass < PassesPerRun; ++pass) {
+        commands.deaths.clear();
+        LifeCycleKernels::ConsumeEnergy(store, 0, count, TickDuration, drain);
+        LifeCycleKernels::Age(store, 0, count, TickDuration);
+        LifeCycleKernels::Integrate(store, 0, count, TickDuration);
+        LifeCycleKernels::CollectDeaths(store, 0, count, commands);
+        deathCount += commands.deaths.size();
+    }
+    const double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return elapsedNs / (static_cast<double>(PassesPerRun) * count);
+}
+
+} // namespace
+
+int main() {
+    std::cout.setstate(std::ios::badbit);
+
+    const InstructionSet best = LifeCycleKernels::Detect();
+    std::printf("Meilleur jeu d'instructions: %s\n", LifeCycleKernels::GetName(best));
+    std::printf("%10s %10s %14s %10s %10s\n", "entites", "isa", "ns/entite", "gain", "identique");
+
+    for (int entityCount : {1000, 10000, 100000, 1000000}) {
+        EntityStore reference;
+        FillStore(reference, entityCount);
+        LifeCycleCommands referenceCommands;
+        size_t referenceDeaths = 0;
+        LifeCycleKernels::SetActive(InstructionSet::Scalar);
+        const double scalarNs = MeasurePass(reference, referenceCommands, referenceDeaths);
+        std::printf("%10d %10s %14.3f %9.2fx %10s\n", entityCount,
+                    LifeCycleKernels::GetName(InstructionSet::Scalar), scalarNs, 1.0, "-");
+
+        for (InstructionSet instructionSet : {InstructionSet::SSE2, InstructionSet::AVX2}) {
+            if (!LifeCycleKernels::SetActive(instructionSet)) continue;
+            EntityStore store;
+            FillStore(store, entityCount);
+            LifeCycleCommands commands;
+            size_t deaths = 0;
+            const double ns = MeasurePass(store, commands, deaths);
+            const bool identical = SameColumns(reference, store) && deaths == referenceDeaths;
+            std::printf("%10d %10s %14.3f %9.2fx %10s\n", entityCount, LifeCycleKernels::GetName(instructionSet),
+                        ns, scalarNs / ns, identical ? "oui" : "NON");
+        }
+    }
+
+    LifeCycleKernels::SetActive(best);
+    return 0;
+}
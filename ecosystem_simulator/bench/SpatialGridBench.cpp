@@ -0,0 +1,97 @@
+// 📈 BENCHMARK DE LA GRILLE SPATIALE
+// Mesure le coût par tick de Ecosystem::Update en fonction du nombre d'entités,
+// et compare les requêtes de voisinage de la grille à un parcours linéaire.
+// La densité est maintenue constante : la taille du monde suit la population.
+#include "Core/Ecosystem.h"
+#include "Core/SpatialGrid.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Ecosystem::Core;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// Surface moyenne par entité (px²) : ~50x50 comme une fenêtre bien peuplée
+constexpr float AreaPerEntity = 2500.0f;
+constexpr int TicksPerRun = 100;
+constexpr float TickDuration = 1.0f / 60.0f;
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// ⏱ COÛT D'UN TICK COMPLET
+double MeasureUpdate(int entityCount) {
+    float side = std::sqrt(entityCount * AreaPerEntity);
+    Ecosystem::Core::Ecosystem world(side, side, entityCount * 2);
+    world.Initialize(entityCount * 6 / 10, entityCount / 10, entityCount * 3 / 10);
+
+    auto start = Clock::now();
+    for (int tick = 0; tick < TicksPerRun; ++tick) {
+        world.Update(TickDuration);
+    }
+    return ElapsedMs(start) / TicksPerRun;
+}
+
+// 🔍 REQUÊTES DE VOISINAGE : grille contre parcours linéaire
+void MeasureQueries(int entityCount, double& gridMs, double& linearMs) {
+    float side = std::sqrt(entityCount * AreaPerEntity);
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> coordinate(0.0f, side);
+
+    std::vector<Vector2D> positions(entityCount);
+    for (auto& position : positions) {
+        position = Vector2D(coordinate(generator), coordinate(generator));
+    }
+
+    SpatialGrid grid(side, side, Entity::PredatorPerceptionRadius);
+    const float radius = Entity::FoodPerceptionRadius;
+    long long checksumGrid = 0;
+    long long checksumLinear = 0;
+
+    auto start = Clock::now();
+    grid.Clear();
+    for (int i = 0; i < entityCount; ++i) {
+        grid.Insert(positions[i], i);
+    }
+    grid.Build();
+    for (const auto& position : positions) {
+        grid.QueryRadius(position, radius, SpatialGrid::AllTags,
+            [&](const SpatialGrid::Item&, float) { ++checksumGrid; });
+    }
+    gridMs = ElapsedMs(start);
+
+    start = Clock::now();
+    for (const auto& position : positions) {
+        for (const auto& other : positions) {
+            if ((other - position).LengthSquared() <= radius * radius) ++checksumLinear;
+        }
+    }
+    linearMs = ElapsedMs(start);
+
+    if (checksumGrid != checksumLinear) {
+        std::cerr << "❌ Résultats différents: " << checksumGrid << " / " << checksumLinear << std::endl;
+    }
+}
+
+} // namespace
+
+int main() {
+    // Les journaux d'entités faussent la mesure : sortie standard muette pendant les runs
+    std::cout.setstate(std::ios::badbit);
+
+    std::printf("%10s %16s %16s %16s\n", "entites", "update ms/tick", "grille ms", "lineaire ms");
+    for (int entityCount : {1000, 2000, 5000, 10000, 20000}) {
+        double updateMs = MeasureUpdate(entityCount);
+        double gridMs = 0.0;
+        double linearMs = 0.0;
+        MeasureQueries(entityCount, gridMs, linearMs);
+        std::printf("%10d %16.3f %16.3f %16.3f\n", entityCount, updateMs, gridMs, linearMs);
+    }
+    return 0;
+}
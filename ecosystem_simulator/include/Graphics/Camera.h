@@ -0,0 +1,55 @@
+#pragma once
+#include "Core/Structs.h"
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🎥 CAMÉRA 2D
+// Relie le monde simulé (taille libre) à la fenêtre : un centre en
+// coordonnées du monde et un zoom en pixels par unité. Le Renderer n'envoie
+// que ce que couvre GetVisibleRect(), quelle que soit la taille du monde.
+class Camera {
+public:
+    // RECTANGLE VISIBLE EN COORDONNÉES DU MONDE
+    struct Rect {
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+    };
+
+    static constexpr float MinZoom = 0.02f;
+    static constexpr float MaxZoom = 16.0f;
+
+private:
+    // ÉTAT
+    Core::Vector2D mCenter;     // Point du monde au centre de l'écran
+    float mZoom;                // Pixels par unité du monde
+    float mViewportWidth;
+    float mViewportHeight;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    Camera(float viewportWidth = 0.0f, float viewportHeight = 0.0f);
+
+    // ⚙ RÉGLAGES
+    void SetViewport(float width, float height);
+    void CenterOn(Core::Vector2D worldPosition);
+    void FitWorld(float worldWidth, float worldHeight);     // Tout le monde à l'écran
+
+    // 🕹 DÉPLACEMENTS
+    void Pan(float screenDeltaX, float screenDeltaY);       // Le monde suit le curseur
+    void ZoomAt(float factor, Core::Vector2D screenPoint);  // Le point sous le curseur reste fixe
+
+    // 🔁 CONVERSIONS
+    Core::Vector2D WorldToScreen(Core::Vector2D worldPosition) const;
+    Core::Vector2D ScreenToWorld(Core::Vector2D screenPosition) const;
+    Rect GetVisibleRect(float margin = 0.0f) const;
+
+    // GETTERS
+    Core::Vector2D GetCenter() const { return mCenter; }
+    float GetZoom() const { return mZoom; }
+};
+
+} // namespace Graphics
+} // namespace Ecosystem
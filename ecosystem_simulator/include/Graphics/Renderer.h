@@ -0,0 +1,86 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "Core/RenderFrame.h"
+#include "Graphics/Camera.h"
+#include "Graphics/SpriteAtlas.h"
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🎨 RENDU DE L'ÉCOSYSTÈME
+// Seul point du projet où l'état de la simulation rencontre SDL :
+// le module Core reste compilable sans SDL (mode headless). Le rendu ne lit
+// qu'une image figée du monde (Core::RenderFrame), jamais l'Ecosystem : il
+// tourne à son propre rythme pendant que la simulation avance sur son thread.
+//
+// 📦 RENDU PAR LOTS : nourriture, entités et barres d'énergie sont des quads
+// accumulés dans un seul tampon de sommets, envoyés par un unique
+// SDL_RenderGeometry par image. Le nombre d'appels de dessin ne dépend plus
+// de la population ; les tampons sont réutilisés d'une image à l'autre.
+//
+// 🖼 SPRITES : chaque entité est le sprite de son espèce, lu dans l'atlas
+// (SpriteAtlas) ; les quads unis pointent sur son carré blanc. Une seule
+// texture pour tout le lot, et la teinte d'énergie
+// (Entity::CalculateColorBasedOnState) passe par la couleur des sommets :
+// ni appel ni changement de texture en plus.
+//
+// 🎥 CULLING : l'image ne contient déjà que la zone de la caméra avec une marge
+// (requête sur les grilles spatiales côté simulation) ; seules les entités du
+// rectangle visible produisent des quads, testées sur les colonnes de l'image.
+class Renderer {
+private:
+    // RESSOURCES SDL
+    SDL_Renderer* mRenderer;
+    SpriteAtlas mAtlas;                     // Libéré avant le renderer SDL (GameEngine détruit Renderer avant Window)
+
+    // LOT DE QUADS
+    std::vector<SDL_Vertex> mVertices;      // 4 sommets par quad
+    std::vector<int> mIndices;              // 6 indices par quad, motif figé (ne grandit qu'au besoin)
+
+    // CAMÉRA DE L'IMAGE EN COURS
+    const Camera* mCamera;
+
+    // COMPTEURS DE LA DERNIÈRE IMAGE
+    int mLastQuadCount;
+    int mLastDrawCalls;
+    int mLastVisibleEntities;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    Renderer();
+
+    // ⚙ INITIALISATION (construit l'atlas à partir du dossier des textures)
+    void Initialize(SDL_Renderer* renderer, const std::string& textureDirectory = SpriteAtlas::DefaultDirectory);
+
+    // RENDU
+    // alpha ∈ [0, 1] : fraction du pas fixe écoulée depuis le dernier tick
+    void DrawEcosystem(const Core::RenderFrame& frame, const Camera& camera, float alpha = 1.0f);
+    // Tableau min / moyenne / p99 par phase (copié dans l'image), en pixels d'écran à partir de (x, y)
+    void DrawProfilerOverlay(const Core::RenderFrame& frame, float x, float y);
+
+    // GETTERS
+    int GetLastQuadCount() const { return mLastQuadCount; }
+    int GetLastDrawCalls() const { return mLastDrawCalls; }
+    int GetLastVisibleEntities() const { return mLastVisibleEntities; }
+
+private:
+    // MÉTHODES INTERNES
+    void DrawWorldBounds(const Core::RenderFrame& frame);
+    void DrawFood(const Core::RenderFrame& frame, const Camera::Rect& visible);
+    void DrawEntities(const Core::RenderFrame& frame, const Camera::Rect& visible, float alpha);
+    void DrawEntity(const Core::RenderFrame& frame, size_t index, float alpha);
+
+    // GESTION DU LOT
+    void BeginBatch();
+    // Coordonnées du monde ; sans zone : carré blanc de l'atlas (quad uni)
+    void PushQuad(float x, float y, float width, float height, Core::Color color);
+    void PushQuad(float x, float y, float width, float height, Core::Color color, const SpriteAtlas::Region& region);
+    void PushScreenQuad(float x, float y, float width, float height, Core::Color color);
+    void PushScreenQuad(float x, float y, float width, float height, Core::Color color, const SpriteAtlas::Region& region);
+    void FlushBatch();
+};
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,77 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "Core/EntityStore.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🖼 ATLAS DE SPRITES
+// Une seule texture RGBA construite au démarrage : le sprite de chaque espèce
+// et un carré blanc pour les quads unis (nourriture, barres d'énergie, bords).
+// Tout le lot d'une image se dessine donc avec la même texture, en un appel.
+//
+// Sprite d'une espèce : <clé>.bmp dans le dossier des textures (clé de
+// SpeciesTraits : herbivore.bmp, carnivore.bmp, plant.bmp), sinon une forme
+// procédurale. Les sprites sont multipliés par la couleur des sommets (espèce
+// et énergie) : à dessiner en blanc ou en niveaux de gris.
+class SpriteAtlas {
+public:
+    // ZONE DE L'ATLAS (coordonnées de texture normalisées)
+    struct Region {
+        float u0, v0;
+        float u1, v1;
+    };
+
+    static constexpr const char* DefaultDirectory = "assets/futures__textures";
+    static constexpr int ProceduralSpriteSize = 32;     // Pixels, sprites générés
+    static constexpr int MaxSpriteSize = 256;           // Au-delà, le fichier est ignoré
+    static constexpr int AtlasWidth = 512;
+
+private:
+    // IMAGE RGBA EN MÉMOIRE (octets R, G, B, A)
+    struct Image {
+        int width = 0;
+        int height = 0;
+        std::vector<uint8_t> pixels;
+    };
+
+    // RESSOURCES
+    SDL_Texture* mTexture;
+    std::array<Region, Core::SpeciesCount> mSpecies;
+    Region mSolid;
+    int mWidth;
+    int mHeight;
+    int mLoadedSprites;             // Sprites lus sur disque (les autres sont procéduraux)
+
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    SpriteAtlas();
+    ~SpriteAtlas();
+
+    SpriteAtlas(const SpriteAtlas&) = delete;
+    SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+    // ⚙ CONSTRUCTION : false si la texture n'a pas pu être créée (rendu en quads unis)
+    bool Build(SDL_Renderer* renderer, const std::string& directory = DefaultDirectory);
+    void Release();
+
+    // GETTERS
+    SDL_Texture* GetTexture() const { return mTexture; }
+    const Region& GetSpecies(Core::EntityType type) const { return mSpecies[static_cast<size_t>(type)]; }
+    const Region& GetSolid() const { return mSolid; }
+    int GetWidth() const { return mWidth; }
+    int GetHeight() const { return mHeight; }
+    int GetLoadedSprites() const { return mLoadedSprites; }
+
+private:
+    // MÉTHODES INTERNES
+    static Image LoadBitmap(const std::string& path);          // Image vide si absent ou illisible
+    static Image MakeProceduralSprite(Core::EntityType type);
+};
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -29,6 +29,7 @@ public:
     // RENDU 
     void Clear(const Core::Color& color = Core::Color(30, 30, 30)); 
     void Present(); 
+    void SetTitle(const std::string& title); 
      
     // GETTERS 
     SDL_Renderer* GetRenderer() const { return mRenderer; } 
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+
+// 📈 COMPTEURS D'ALLOCATIONS
+// Compilé avec -DECOSYSTEM_TRACK_ALLOCATIONS, AllocationCounter.cpp remplace
+// les opérateurs new/delete globaux et compte chaque allocation du programme
+// (compteurs atomiques, coût négligeable). Sans ce drapeau, rien n'est
+// remplacé et les compteurs restent à zéro.
+class AllocationCounter {
+public:
+#ifdef ECOSYSTEM_TRACK_ALLOCATIONS
+    static constexpr bool Enabled = true;
+#else
+    static constexpr bool Enabled = false;
+#endif
+
+    // RELEVÉ CUMULÉ DEPUIS LE DÉMARRAGE
+    struct Snapshot {
+        uint64_t allocations;
+        uint64_t deallocations;
+        uint64_t bytes;
+    };
+
+    static Snapshot Read();
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,73 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+
+// USAGE D'UN FLUX ALÉATOIRE (deux usages d'un même tick ne se recouvrent jamais)
+enum class RandomStream : uint32_t {
+    Movement = 1,
+    Reproduction = 2,
+    World = 3           // Apparitions, positions, croissance des plantes
+};
+
+// 🎲 GÉNÉRATEUR À COMPTEUR (Philox4x32-10)
+// Aucun état à conserver : chaque tirage est une fonction pure de
+// (graine du monde, sujet, tick, usage, rang du tirage). Le sujet est l'ID
+// d'une entité (64 bits, dont 56 distincts) ou un numéro de tirage du monde. Un flux se construit sur la
+// pile au moment du besoin, coûte 40 octets, et donne le même résultat quel
+// que soit le thread ou l'ordre d'exécution.
+class CounterRandom {
+public:
+    using Block = std::array<uint32_t, 4>;
+
+    // 🏗 CONSTRUCTEUR
+    // Les bits hauts du sujet partagent le mot de l'usage (usage < 256) : un sujet
+    // sous 2^32 donne exactement les mêmes tirages qu'un sujet de 32 bits
+    CounterRandom(uint64_t seed, uint64_t subject, uint32_t tick, RandomStream stream)
+        : mKey(seed),
+          mCounter{0, static_cast<uint32_t>(subject), tick,
+                   static_cast<uint32_t>(stream) | (static_cast<uint32_t>(subject >> 32) << 8)},
+          mBlock{}, mLane(4) {}
+
+    // ⚙ TIRAGES
+    uint32_t NextUInt() {
+        if (mLane == 4) {
+            mBlock = Philox(mCounter, mKey);
+            mCounter[0]++;
+            mLane = 0;
+        }
+        return mBlock[mLane++];
+    }
+
+    // Uniforme dans [0, 1) : 24 bits, la précision d'un float
+    float NextFloat() { return static_cast<float>(NextUInt() >> 8) * (1.0f / 16777216.0f); }
+    float NextFloat(float minimum, float maximum) { return minimum + (maximum - minimum) * NextFloat(); }
+
+    // 🔐 FONCTION DE BLOC : 10 tours de Philox sur un compteur de 128 bits
+    static Block Philox(Block counter, uint64_t key) {
+        uint32_t key0 = static_cast<uint32_t>(key);
+        uint32_t key1 = static_cast<uint32_t>(key >> 32);
+        for (int round = 0; round < 10; ++round) {
+            uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * counter[0];
+            uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * counter[2];
+            counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key0,
+                       static_cast<uint32_t>(product1),
+                       static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key1,
+                       static_cast<uint32_t>(product0)};
+            key0 += 0x9E3779B9u;
+            key1 += 0xBB67AE85u;
+        }
+        return counter;
+    }
+
+private:
+    uint64_t mKey;
+    Block mCounter;     // {rang du bloc, sujet (bits bas), tick, usage | sujet (bits hauts) << 8}
+    Block mBlock;       // Quatre tirages d'avance
+    uint32_t mLane;
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -1,42 +1,133 @@
 #pragma once 
 #include "Core/Ecosystem.h"
 #include "Entity.h" 
+#include "EntityStore.h" 
 #include "Structs.h" 
-#include <vector> 
+#include "SpatialGrid.h" 
+#include "FoodStore.h" 
+#include "SpeciesParameters.h" 
+#include "JobSystem.h" 
+#include "CounterRandom.h" 
+#include "Profiler.h" 
+#include "StatisticsRecorder.h" 
+#include <array> 
+#include <cstdint> 
 #include <memory> 
-#include <random> 
-#include <SDL3/SDL.h>
+#include <vector> 
+#include <string> 
 
 namespace Ecosystem { 
 namespace Core { 
 
+// 🧩 DOMAINE POSSÉDÉ (monde réparti entre processus, voir ShardedWorld.h) 
+// Par défaut tout le monde, éclat 0 : le comportement est celui d'un monde seul. 
+struct WorldDomain { 
+    float minX; 
+    float minY; 
+    float maxX; 
+    float maxY; 
+    uint32_t shard;                     // Sépare les tirages du monde et les plages d'ID des éclats 
+}; 
+
+// 👻 FANTÔME : entité d'un domaine voisin, visible des perceptions mais jamais mise à jour ici 
+struct GhostEntity { 
+    Vector2D position; 
+    EntityType type; 
+}; 
+
 class Ecosystem { 
-    
-private: 
-    // ÉTAT INTERNE 
-    std::vector<std::unique_ptr<Entity>> mEntities; 
-    std::vector<Food> mFoodSources; 
-    float mWorldWidth; 
-    float mWorldHeight; 
-    int mMaxEntities; 
-    int mDayCycle; 
+public: 
+    // Taille des tranches parallèles : fixe, pour que le résultat ne dépende pas du nombre de threads 
+    static constexpr size_t UpdateChunkSize = 1024; 
 
-    // Générateur aléatoire 
-    std::mt19937 mRandomGenerator; 
+    // 📅 JOURNÉE : une minute simulée au pas par défaut (1/60 s) 
+    static constexpr int TicksPerDay = 3600; 
+    static constexpr size_t DayHistorySize = 365;      // Journées gardées dans l'historique 
 
-    // STATISTIQUES 
+    // 🧩 PLAGES D'ID : l'éclat k crée ses entités à partir de k << ShardIdBits 
+    static constexpr int ShardIdBits = 40; 
+
+    // STATISTIQUES (tenues à jour aux naissances et aux morts : aucune lecture ne parcourt la population) 
     struct Statistics { 
         int totalHerbivores; 
         int totalCarnivores; 
         int totalPlants; 
         int totalFood; 
-        int deathsToday; 
+        int deathsToday;                // Remis à zéro à chaque changement de jour 
         int birthsToday; 
-    } mStats; 
+        int day;                        // Jour en cours, depuis Initialize 
+        int totalDeaths;                // Depuis Initialize 
+        int totalBirths; 
+    }; 
+
+    // BILAN D'UNE JOURNÉE TERMINÉE 
+    struct DayRecord { 
+        int32_t day; 
+        int32_t births; 
+        int32_t deaths; 
+        int32_t herbivores;             // Populations au dernier tick du jour 
+        int32_t carnivores; 
+        int32_t plants; 
+        int32_t minimumPopulation;      // Entités vivantes, extrêmes sur la journée 
+        int32_t maximumPopulation; 
+    }; 
+
+
+private: 
+    // ÉTAT INTERNE 
+    EntityStore mEntities;              // Tableaux SoA, Entity n'en est qu'une vue 
+    FoodStore mFood;                    // Nourriture au sol, indexée au fil des ajouts et retraits 
+    SpeciesTable mSpecies;              // Réglages des espèces de ce monde (aucun état global) 
+    float mWorldWidth; 
+    float mWorldHeight; 
+    int mMaxEntities; 
+    int mDayCycle;                      // Ticks depuis Initialize (jour = mDayCycle / TicksPerDay) 
+
+    // ALÉATOIRE À COMPTEUR : aucun générateur à faire avancer, seulement des clés 
+    uint64_t mWorldSeed; 
+    uint32_t mWorldDraws;               // Numéro du prochain flux du monde (apparitions, nourriture) 
+
+    // PARALLÉLISME 
+    std::unique_ptr<JobSystem> mJobSystem; 
+    std::vector<LifeCycleCommands> mChunkCommands;          // Une file de commandes par tranche 
+    // Réduction par tranche des moyennes enregistrées, indexée par EntityType 
+    struct ChunkTotals { 
+        std::array<double, SpeciesCount> energy; 
+        std::array<double, SpeciesCount> age; 
+    }; 
+    std::vector<ChunkTotals> mChunkTotals; 
+
+    // DOMAINE ET FANTÔMES (mode réparti) 
+    WorldDomain mDomain; 
+    float mDomainFraction;              // Part de la surface du monde possédée (1 = monde entier) 
+    std::vector<GhostEntity> mGhosts;   // Voisins du bord, remplacés avant chaque tick 
+
+    // INDEX SPATIAL (reconstruit à chaque tick) 
+    SpatialGrid mEntityGrid;            // Entités vivantes puis fantômes (indices négatifs), tag = EntityType 
+    std::vector<size_t> mUnindexedEntities;     // Créées depuis la dernière reconstruction de mEntityGrid 
+    // Cases vivantes de chaque espèce (indice = EntityType), croissantes, reconstruites avec mEntityGrid : 
+    // les boucles par espèce ne testent ni le type ni la vie 
+    std::array<std::vector<uint32_t>, SpeciesCount> mSpeciesMembers; 
+    std::array<float, SpeciesCount> mLargestSize;       // Plus grande taille vivante par espèce (rayon de la phase large) 
+
+    // PRÉDATION ET BROUTAGE (tampons gardés d'un tick à l'autre) 
+    static constexpr uint32_t NoClaim = ~uint32_t(0); 
+    std::vector<LifeCycleCommands::Meal> mMeals;        // Contacts du tick, toutes espèces, dans l'ordre des tranches 
+    std::vector<uint32_t> mPreyClaims;                  // Par case : repas retenu pour cette proie, NoClaim sinon 
+
+    // STATISTIQUES 
+    Statistics mStats; 
+    int mMinimumPopulationToday; 
+    int mMaximumPopulationToday; 
+    std::array<DayRecord, DayHistorySize> mDayHistory;     // Anneau : les plus anciennes journées sont écrasées 
+    size_t mDayHistoryNext; 
+    size_t mDayHistoryCount; 
+    Profiler mProfiler;                 // Durée de chaque phase de Update 
+    StatisticsRecorder mStatisticsRecorder;     // Série temporelle tick par tick (si ouverte) 
 
 public: 
     // CONSTRUCTEUR/DESTRUCTEUR 
-    Ecosystem(float width, float height, int maxEntities = 500); 
+    Ecosystem(float width, float height, int maxEntities = 500, int threadCount = 1); 
     ~Ecosystem(); 
 
     // MÉTHODES PUBLIQUES 
@@ -46,27 +137,74 @@ public:
     void RemoveDeadEntities(); 
     void HandleReproduction(); 
     void HandleEating(); 
+    void SetSeed(uint64_t seed); 
+    void SetThreadCount(int threadCount);       // 0 = tous les cœurs 
+    void SetSpecies(const SpeciesTable& species) { mSpecies = species; }    // Pour les apparitions suivantes 
+
+    // 🧩 MODE RÉPARTI : apparitions limitées au domaine, fantômes des voisins, migrations 
+    void SetDomain(const WorldDomain& domain);          // Avant Initialize 
+    void SetGhosts(const std::vector<GhostEntity>& ghosts) { mGhosts = ghosts; }    // Pris en compte au tick suivant 
+    EntityRecord ReleaseEntity(size_t index);           // Retirée sans compter de mort 
+    void AdoptEntity(const EntityRecord& record);       // Accueillie sans compter de naissance ni appliquer la limite 
+
+    // 💾 INSTANTANÉS (format binaire versionné, voir Snapshot.h) 
+    bool SaveSnapshot(const std::string& path) const; 
+    bool LoadSnapshot(const std::string& path);     // false : monde courant inchangé 
+    // Empreinte de tout l'état simulé (entités, cases, nourriture, aléatoire, statistiques) : 
+    // deux mondes de même empreinte donnent la même suite de ticks 
+    uint64_t ComputeStateHash() const; 
 
     // GETTERS 
-    int GetEntityCount() const { return mEntities.size(); } 
-    int GetFoodCount() const { return mFoodSources.size(); } 
+    int GetEntityCount() const { return static_cast<int>(mEntities.LiveCount()); } 
+    const EntityStore& GetEntities() const { return mEntities; } 
+    int GetFoodCount() const { return static_cast<int>(mFood.Size()); } 
+    const FoodStore& GetFood() const { return mFood; } 
+    int GetDayCycle() const { return mDayCycle; } 
+    int GetMaxEntities() const { return mMaxEntities; } 
+    const SpeciesTable& GetSpecies() const { return mSpecies; } 
+    const WorldDomain& GetDomain() const { return mDomain; } 
+    uint64_t GetSeed() const { return mWorldSeed; } 
+    int GetThreadCount() const { return mJobSystem->GetThreadCount(); } 
     Statistics GetStatistics() const { return mStats; } 
+    size_t GetDayHistoryCount() const { return mDayHistoryCount; } 
+    // 0 = dernière journée terminée, jusqu'à GetDayHistoryCount() - 1 
+    const DayRecord& GetDayRecord(size_t daysAgo) const { 
+        return mDayHistory[(mDayHistoryNext + DayHistorySize - 1 - daysAgo) % DayHistorySize]; 
+    } 
+    const Profiler& GetProfiler() const { return mProfiler; } 
+    Profiler& GetProfiler() { return mProfiler; }     // Rendu mesuré par l'appelant, export CSV 
+    StatisticsRecorder& GetStatisticsRecorder() { return mStatisticsRecorder; } 
     float GetWorldWidth() const { return mWorldWidth; } 
     float GetWorldHeight() const { return mWorldHeight; } 
+    const SpatialGrid& GetEntityGrid() const { return mEntityGrid; } 
+    // Entités absentes de GetEntityGrid() (nées après sa construction) : à parcourir en plus 
+    // d'une requête sur la grille. Les cases de la grille ne sont jamais réattribuées avant 
+    // la reconstruction suivante (recyclage en début de tick). 
+    const std::vector<size_t>& GetUnindexedEntities() const { return mUnindexedEntities; } 
 
     // MÉTHODES DE GESTION 
-    void AddEntity(std::unique_ptr<Entity> entity); 
+    bool AddEntity(EntityType type, Vector2D position); 
     void AddFood(Vector2D position, float energy = 25.0f); 
 
-    // RENDU 
-    void Render(SDL_Renderer* renderer) const; 
-
 private: 
     //MÉTHODES PRIVÉES 
     void UpdateStatistics(); 
+    void RecordStatistics(); 
+    void RollOverDay(); 
+    void ResetStatistics(); 
     void SpawnRandomEntity( EntityType type); 
-    Vector2D GetRandomPosition(); 
+    Vector2D GetRandomPosition( CounterRandom& random) const; 
+    CounterRandom NextWorldRandom(); 
     void HandlePlantGrowth( float deltaTime); 
+    void RebuildSpatialIndex(); 
+    void HandleBehaviors( float deltaTime); 
+    // Boucles spécialisées par espèce (SpeciesTraits.h), définies dans Ecosystem.cpp 
+    template <typename Species> void BehaveSpecies( float deltaTime); 
+    template <typename Species> void FeedSpecies(); 
+    template <typename Species> void ProposeMeals(); 
+    void UpdateEntities( float deltaTime); 
+    void PrepareChunks( size_t count); 
+    uint32_t CurrentTick() const { return static_cast<uint32_t>(mDayCycle); } 
 }; 
 
 
@@ -0,0 +1,85 @@
+#pragma once
+#include "HeadlessRunner.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🧪 AXE D'UN BALAYAGE : une clé et ses valeurs, telles qu'écrites dans le fichier
+struct SweepAxis {
+    std::string key;
+    std::vector<std::string> values;
+};
+
+// 📋 BALAYAGE DE PARAMÈTRES
+// Fichier texte, une clé par ligne suivie d'une ou plusieurs valeurs ; « # » commente
+// la fin de la ligne :
+//
+//   ticks 6000
+//   herbivores 100 200
+//   carnivore.drain 1.5 2 2.5
+//   seed 1..8
+//
+// Clés : ticks, dt, world-width, world-height, max-entities, herbivores, carnivores,
+// plants, seed (liste ou intervalle A..B), et <herbivore|carnivore|plant>.<energy|
+// max-energy|max-age|size|drain> pour la table des espèces.
+// Les exécutions forment le produit cartésien des axes : le premier axe varie le
+// plus lentement, la graine le plus vite. Une configuration regroupe les
+// exécutions qui ne diffèrent que par la graine.
+struct SweepDescription {
+    std::vector<SweepAxis> axes;        // Sans la graine
+    std::vector<uint64_t> seeds;        // Vide = graine de la configuration de base
+
+    static bool Load(const std::string& path, SweepDescription& sweep, std::string& error);
+    // Valeur appliquée à une configuration ; false si la clé ou la valeur est invalide
+    static bool ApplyValue(const std::string& key, const std::string& value, HeadlessConfig& config);
+
+    size_t GetConfigurationCount() const;
+    size_t GetRunCount() const { return GetConfigurationCount() * (seeds.empty() ? 1 : seeds.size()); }
+};
+
+// 🧬 ENSEMBLE DE SIMULATIONS
+// Chaque exécution possède son Ecosystem (graine, espèces, tirages, statistiques)
+// et tourne sur un seul thread : les mondes ne partagent aucun état modifiable et
+// plusieurs tournent en même temps, un par cœur. Les résultats sont rangés par
+// indice d'exécution : la table ne dépend pas de l'ordre d'achèvement.
+class EnsembleRunner {
+public:
+    // 📊 UNE LIGNE DE LA TABLE
+    struct RunResult {
+        size_t configuration;
+        uint64_t seed;                  // Graine effective (tirée si la configuration n'en fixe pas)
+        std::vector<size_t> valueIndex; // Valeur retenue sur chaque axe
+        HeadlessRunner::Result result;
+    };
+
+private:
+    // 🔒 ÉTAT
+    HeadlessConfig mBase;
+    SweepDescription mSweep;
+    std::vector<RunResult> mResults;
+    double mWallSeconds;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    // Sorties par exécution (profilage, statistiques, journal, instantanés) ignorées
+    EnsembleRunner(const HeadlessConfig& base, const SweepDescription& sweep);
+
+    // ⚙️ EXÉCUTION : threadCount mondes à la fois (0 = tous les cœurs)
+    void Run(int threadCount);
+    // Table complète en CSV, une ligne par exécution ; chemin vide = sortie standard
+    bool WriteTable(const std::string& path) const;
+    void PrintSummary() const;
+
+    // GETTERS
+    const std::vector<RunResult>& GetResults() const { return mResults; }
+
+private:
+    // MÉTHODES PRIVÉES
+    HeadlessConfig MakeConfig(size_t runIndex, RunResult& run) const;
+};
+
+} // namespace Core
+} // namespace Ecosystem
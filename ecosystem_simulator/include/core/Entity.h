@@ -1,83 +1,186 @@
-#pragma once 
+#pragma once
 #include "Core/Entity.h"
-#include "Structs.h" 
-#include <SDL3/SDL.h> 
-#include <memory> 
-#include <random> 
-#include <vector> 
-
-namespace Ecosystem { 
-namespace Core { 
-
-// ÉNUMÉRATION DES TYPES D'ENTITÉS 
-enum class EntityType { 
-    HERBIVORE, 
-    CARNIVORE, 
-    PLANT 
-}; 
-
-class Entity { 
-private: 
-    // DONNÉES PRIVÉES - État interne protégé 
-    float mEnergy; 
-    float mMaxEnergy; 
-    int mAge; 
-    int mMaxAge; 
-    bool mIsAlive; 
-    Vector2D mVelocity; 
-    EntityType mType; 
-
-    // Générateur aléatoire 
-    mutable std::mt19937 mRandomGenerator; 
-
-public: 
-    // DONNÉES PUBLIQUES - Accès direct sécurisé 
-    Vector2D position; 
-    Color color; 
-    float size; 
-    std::string name; 
-
-    // CONSTRUCTEURS 
-    Entity( EntityType type, Vector2D pos, std::string entityName = "Unnamed"); 
-    Entity ( const Entity& other);  // Constructeur de copie 
-
-    // DESTRUCTEUR 
-    ~Entity(); 
-
-    // ⚙MÉTHODES PUBLIQUES 
-    void Update( float deltaTime); 
-    void Move( float deltaTime); 
-    void Eat( float energy); 
-    bool CanReproduce() const; 
-    std::unique_ptr<Entity> Reproduce(); 
-    void ApplyForce(Vector2D force); 
-
-    // GETTERS - Accès contrôlé aux données privées 
-    float GetEnergy() const { return mEnergy; } 
-    float GetEnergyPercentage() const { return mEnergy / mMaxEnergy; } 
-    int GetAge() const { return mAge; } 
-    bool IsAlive() const { return mIsAlive; } 
-    EntityType GetType() const { return mType; } 
-    Vector2D GetVelocity() const { return mVelocity; } 
-
-    // MÉTHODES DE COMPORTEMENT 
-    Vector2D SeekFood( const std::vector<Food>& foodSources) const; 
-    Vector2D AvoidPredators( const std::vector<Entity>& predators) const; 
+#include "Structs.h"
+#include "EntityStore.h"
+#include "SpatialGrid.h"
+#include "FoodStore.h"
+#include "CounterRandom.h"
+#include "SpeciesParameters.h"
+#include "SpeciesTraits.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 📨 COMMANDES DIFFÉRÉES D'UNE TRANCHE D'ENTITÉS
+// Les passes parallèles n'écrivent que dans les colonnes de leur propre tranche ;
+// naissances et morts sont consignées ici puis appliquées dans l'ordre des tranches.
+struct LifeCycleCommands {
+    struct Death {
+        size_t index;
+        bool starvation;
+    };
+    // Contact mangeur/proie trouvé par la phase large (Ecosystem::HandleEating)
+    struct Meal {
+        uint32_t eater;
+        uint32_t prey;
+        float distanceSquared;          // Départage des mangeurs d'une même proie
+        float bite;                     // Énergie prélevée au plus (SpeciesTraits<Species>::BiteEnergy)
+    };
+    std::vector<Death> deaths;
+    std::vector<size_t> birthParents;
+    std::vector<Meal> meals;
+
+    void Clear() { deaths.clear(); birthParents.clear(); meals.clear(); }
+};
+
+// 👁 VUE SUR UNE ENTITÉ DU STOCKAGE SoA
+// Légère (pointeur + indice), copiable par valeur : les données vivent dans
+// EntityStore. Les cases ne bougent jamais ; après EntityStore::RecycleDead(),
+// la case d'un mort peut accueillir une autre entité (comparer GetId()).
+class Entity {
+public:
+    // RAYONS DE PERCEPTION (dimensionnent la grille spatiale de l'écosystème)
+    static constexpr float FoodPerceptionRadius = 150.0f;
+    static constexpr float PredatorPerceptionRadius = 80.0f;
+
+private:
+    // RÉFÉRENCE VERS LES DONNÉES
+    EntityStore* mStore;
+    size_t mIndex;
+
+public:
+    // CONSTRUCTEUR
+    Entity( EntityStore& store, size_t index) : mStore( &store), mIndex( index) {}
+
+    // 🏗 CRÉATION DANS LE STOCKAGE
+    static Entity Create( EntityStore& store, EntityType type, Vector2D pos, CounterRandom& random,
+                          const SpeciesParameters& parameters);
+    static Entity CreateOffspring( EntityStore& store, size_t parentIndex);  // Le parent paie le coût
+    static void ApplyDeath( EntityStore& store, const LifeCycleCommands::Death& death);
+
+    // ⚙ PASSES DU CYCLE DE VIE (sur la tranche [begin, end) des tableaux)
+    // Les tirages de chaque entité dépendent de (worldSeed, ID, tick) seulement
+    static void UpdateRange( EntityStore& store, size_t begin, size_t end, float deltaTime,
+                             const SpeciesTable& species, uint64_t worldSeed, uint32_t tick,
+                             LifeCycleCommands& commands);
+
+    // ⚙MÉTHODES PUBLIQUES
+    void Eat( float energy);
+    bool CanReproduce() const;
+    bool Reproduce( uint64_t worldSeed, uint32_t tick) const;  // Tirage seulement : la naissance est différée
+    template <typename Species> void ApplyForce( Vector2D force);   // Vitesse bornée à SpeciesTraits<Species>::MaxSpeed
+
+    // GETTERS - Accès contrôlé aux données
+    size_t GetIndex() const { return mIndex; }
+    uint64_t GetId() const { return mStore->id[mIndex]; }
+    uint64_t GetParentId() const { return mStore->parentId[mIndex]; }   // EntityStore::NoParent si apparue
+    Vector2D GetPosition() const { return mStore->GetPosition( mIndex); }
+    Vector2D GetVelocity() const { return Vector2D( mStore->velocityX[mIndex], mStore->velocityY[mIndex]); }
+    float GetEnergy() const { return mStore->energy[mIndex]; }
+    float GetEnergyPercentage() const { return mStore->energy[mIndex] / mStore->maxEnergy[mIndex]; }
+    float GetAge() const { return mStore->age[mIndex]; }
+    bool IsAlive() const { return mStore->alive[mIndex] != 0; }
+    EntityType GetType() const { return mStore->type[mIndex]; }
+    float GetSize() const { return mStore->size[mIndex]; }
+    Color GetColor() const { return mStore->color[mIndex]; }
+    EntityName GetName() const { return EntityName( mStore->type[mIndex], mStore->id[mIndex]); }
+
+    // MÉTHODES DE COMPORTEMENT
+    // Les grilles indexent les entités (tag = EntityType) et la nourriture.
+    // Species doit être l'espèce de l'entité : la chaîne alimentaire est résolue à la compilation
+    template <typename Species> Vector2D SeekFood( const SpatialGrid& entityGrid, const FoodStore& food) const;
+    template <typename Species> Vector2D AvoidPredators( const SpatialGrid& entityGrid) const;
     Vector2D StayInBounds( float worldWidth, float worldHeight) const;
 
-    // MÉTHODE DE RENDU 
-    void Render(SDL_Renderer* renderer) const;
+    // COULEUR D'AFFICHAGE (utilisée par Graphics::Renderer)
+    static Color CalculateColorBasedOnState( const EntityStore& store, size_t index);
+    static Color CalculateColorBasedOnState( Color baseColor, float energyRatio);   // Copie figée (RenderFrame)
 
-private: 
-    // MÉTHODES PRIVÉES - Logique interne 
-    void ConsumeEnergy( float deltaTime); 
-    void Age( float deltaTime); 
-    void CheckVitality(); 
-    Vector2D GenerateRandomDirection(); 
-    Color CalculateColorBasedOnState() const; 
-}; 
+private:
+    // PASSES PRIVÉES - Logique interne, une colonne à la fois
+    static void Move( EntityStore& store, size_t begin, size_t end, float deltaTime, uint64_t worldSeed, uint32_t tick);
+    static Vector2D GenerateRandomDirection( CounterRandom& random);
+};
 
-} // namespace Core 
-} // namespace Ecosystem
+//APllication une force physique à l'entite (simulation de movement)
+template <typename Species>
+void Entity::ApplyForce( Vector2D force) {
+    //addition vevctoriel de la force à la velocité actuelle
+    Vector2D velocity = GetVelocity() + force;
+    // Vitesses exprimées dans l'unité de Move (×20 px/s)
+    constexpr float maxSpeed = SpeciesTraits<Species>::MaxSpeed;
+    float currentSpeed = velocity.Length();
+
+    // Condition d'evaluation de la vitesse de déplacement: si maximum → ramener au minimum
+    if ( currentSpeed > maxSpeed) {
+        velocity = velocity * ( maxSpeed / currentSpeed);
+    }
+    mStore->velocityX[mIndex] = velocity.x;
+    mStore->velocityY[mIndex] = velocity.y;
+}
+
+// Fonction permettant aux entite ( animaux) d'echaper aux predateur: fonction de survi
+template <typename Species>
+Vector2D Entity::AvoidPredators( const SpatialGrid& entityGrid) const {
+    Vector2D avoidance( 0.0f, 0.0f);
+    // Selection ou flitrage : seules les espèces qui ont un prédateur fuient
+    if constexpr ( SpeciesTraits<Species>::HasPredator) {
+        Vector2D position = GetPosition();
+
+        // ANALYSE DES PRÉDATEURS : seuls ceux, vivants, des cellules voisines
+        // (la grille n'indexe que les entités vivantes)
+        constexpr uint32_t predatorMask = SpatialGrid::MaskOf( static_cast<int>( SpeciesTraits<Species>::Predator));
+        entityGrid.QueryRadius( position, PredatorPerceptionRadius, predatorMask,
+            [&]( const SpatialGrid::Item& predator, float distanceSquared) {
+                // ZONE DE DANGER : Si le prédateur est dans un rayon de 80 unités
+                if ( distanceSquared <= 0.0f) return;
+                Vector2D toPredator = predator.position - position;
+                float distance = std::sqrt( distanceSquared);
+
+                // CALCUL DE FUITE : Direction opposée au prédateur
+                // L'intensité augmente avec la proximité
+                Vector2D fleeDirection = -toPredator.Normalized();
+                avoidance = avoidance + fleeDirection * ( PredatorPerceptionRadius - distance);
+            });
+    }
+    return avoidance;
+}
 
-//-IC:/msys64/ucrt64/include/SDL3 -LC:/msys64/ucrt64/lib -lSDL3
\ No newline at end of file
+// Fonction SeekFood prend en charge la recherche de nutriment pour la survie et le maintien d'energie
+template <typename Species>
+Vector2D Entity::SeekFood( const SpatialGrid& entityGrid, const FoodStore& food) const {
+    // EXCLUSION : les espèces sans proie ne cherchent pas de nourriture (photosynthèse)
+    if constexpr ( !SpeciesTraits<Species>::HasPrey) {
+        return Vector2D( 0.0f, 0.0f);
+    } else {
+        Vector2D position = GetPosition();
+
+        // CHAÎNE ALIMENTAIRE : la proie de l'espèce (SpeciesTraits<Species>::Prey)
+        constexpr uint32_t preyMask = SpatialGrid::MaskOf( static_cast<int>( SpeciesTraits<Species>::Prey));
+        const SpatialGrid::Item* best = entityGrid.FindNearest( position, FoodPerceptionRadius, preyMask);
+        bool found = best != nullptr;
+        Vector2D target = found ? best->position : position;
+
+        // SÉLECTION : On garde la nourriture valide la plus proche
+        if constexpr ( SpeciesTraits<Species>::EatsGroundFood) {
+            const FoodHandle nearest = food.FindNearest( position, FoodPerceptionRadius);
+            if ( !nearest.IsNull() && ( !found ||
+                 ( food.Get( nearest).position - position).LengthSquared() < ( target - position).LengthSquared())) {
+                target = food.Get( nearest).position;
+                found = true;
+            }
+        }
+
+        // ACTION : Se déplacer vers la nourriture si elle est assez proche (rayon de 150)
+        if ( !found) {
+            return Vector2D( 0.0f, 0.0f);
+        }
+        return ( target - position).Normalized() * 2.0f;
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
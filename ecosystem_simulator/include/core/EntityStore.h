@@ -0,0 +1,138 @@
+#pragma once
+#include "Structs.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// ÉNUMÉRATION DES TYPES D'ENTITÉS
+enum class EntityType : uint8_t {
+    HERBIVORE,
+    CARNIVORE,
+    PLANT
+};
+constexpr size_t SpeciesCount = 3;         // Valeurs de EntityType (voir SpeciesTraits.h)
+
+// 🏷 NOM D'UNE ENTITÉ, formaté à la demande ("Herbivore_42")
+// Rien n'est stocké par entité : le nom se déduit du type et de l'ID, dans un
+// tampon sur la pile, seulement quand un journal ou l'interface l'affiche.
+class EntityName {
+public:
+    EntityName(EntityType type, uint64_t id);
+
+    const char* GetText() const { return mText; }
+    static const char* GetTypeName(EntityType type);
+
+    // Place laissée au nom d'espèce (vérifié à la compilation dans SpeciesTraits.h)
+    static constexpr size_t MaxTypeNameLength = 10;
+    static constexpr size_t MaxIdDigits = 20;       // uint64_t
+
+private:
+    char mText[MaxTypeNameLength + 1 + MaxIdDigits + 1];     // "Carnivore_" + 20 chiffres + '\0'
+};
+
+// 📦 ENTITÉ HORS DU STOCKAGE : toutes ses colonnes, ID compris (migration entre
+// domaines d'un monde réparti, voir ShardedWorld.h)
+struct EntityRecord {
+    float positionX;
+    float positionY;
+    float velocityX;
+    float velocityY;
+    float energy;
+    float maxEnergy;
+    float age;
+    float maxAge;
+    float size;
+    Color color;
+    EntityType type;
+    uint8_t reserved[7];                    // Remplissage explicite : enregistrement copié octet par octet
+    uint64_t id;
+    uint64_t parentId;
+};
+
+// 🗃 STOCKAGE DES ENTITÉS EN STRUCTURE DE TABLEAUX (SoA)
+// Chaque attribut vit dans son propre tableau contigu : une passe du cycle de
+// vie ne charge que les colonnes dont elle a besoin. L'indice d'une entité est
+// le même dans tous les tableaux ; Entity n'est qu'une vue (store, indice).
+//
+// ♻ RECYCLAGE DES CASES : les tableaux ne rétrécissent pas. Une entité morte
+// reste en place (alive = 0) ; RecycleDead() ajoute sa case à la liste libre
+// et la prochaine naissance la réoccupe. Une fois la population stabilisée,
+// naissances et morts ne touchent plus l'allocateur. Size() est donc le
+// nombre de cases, LiveCount() le nombre d'entités vivantes.
+//
+// 🔢 POPULATIONS : tenues à jour par Add() et Kill(), seuls points d'entrée
+// des naissances et des morts ; LiveCount(type) ne parcourt rien.
+class EntityStore {
+public:
+    // DONNÉES CHAUDES - parcourues à chaque tick
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> previousPositionX;  // Position au tick précédent (interpolation du rendu)
+    std::vector<float> previousPositionY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> energy;
+    std::vector<float> maxEnergy;
+    std::vector<float> age;                // En unités de jeu (10 par seconde simulée)
+    std::vector<float> maxAge;
+    std::vector<EntityType> type;
+    std::vector<uint8_t> alive;
+    std::vector<uint64_t> id;              // Identifiant stable (clé des flux aléatoires), jamais réutilisé
+
+    // DONNÉES TIÈDES - rendu et interactions
+    std::vector<float> size;
+    std::vector<Color> color;
+
+    // DONNÉES FROIDES - lignée
+    static constexpr uint64_t NoParent = ~uint64_t(0);
+    std::vector<uint64_t> parentId;        // ID du parent, NoParent pour une apparition
+
+    // ⚙ GESTION
+    // Réoccupe la dernière case libérée, sinon ajoute une case en fin de tableaux
+    size_t Add(EntityType entityType, Vector2D position, Vector2D velocity,
+               float initialEnergy, float maximumEnergy, float maximumAge,
+               float entitySize, Color entityColor, uint64_t parent = NoParent);
+    void Kill(size_t index);        // La case n'est réutilisable qu'après RecycleDead()
+    // Migration : copie complète d'une entité, réinsertion avec son ID et son âge
+    EntityRecord Extract(size_t index) const;
+    size_t Insert(const EntityRecord& record);
+    size_t RecycleDead();           // Libère les cases des morts du tick, retourne leur nombre
+    void SavePreviousPositions();
+    void Reserve(size_t capacity);
+    void Clear();
+
+    // GETTERS
+    size_t Size() const { return type.size(); }
+    size_t LiveCount() const { return type.size() - mFreeSlots.size() - mPendingDeaths.size(); }
+    size_t LiveCount(EntityType entityType) const { return mLiveByType[static_cast<size_t>(entityType)]; }
+    size_t FreeSlotCount() const { return mFreeSlots.size(); }
+    bool Empty() const { return LiveCount() == 0; }
+    Vector2D GetPosition(size_t index) const { return Vector2D(positionX[index], positionY[index]); }
+
+    // 💾 COMPTABILITÉ DES CASES (instantanés : à restaurer telle quelle pour un résultat identique)
+    uint64_t GetNextId() const { return mNextId; }
+    const std::vector<size_t>& GetFreeSlots() const { return mFreeSlots; }
+    const std::vector<size_t>& GetPendingDeaths() const { return mPendingDeaths; }
+    // Recompte aussi les populations depuis les colonnes type et alive
+    void RestoreSlots(uint64_t nextId, std::vector<size_t> freeSlots, std::vector<size_t> pendingDeaths);
+    // Premier ID des prochaines créations (domaines d'un monde réparti : plages disjointes)
+    void SetNextId(uint64_t nextId) { mNextId = nextId; }
+
+private:
+    uint64_t mNextId = 0;                   // Remis à zéro par Clear() : même graine, mêmes IDs
+    std::vector<size_t> mFreeSlots;         // Pile : la dernière case libérée est réoccupée en premier
+    std::vector<size_t> mPendingDeaths;     // Morts du tick, encore référencés par les grilles
+    std::array<size_t, SpeciesCount> mLiveByType = {}; // Entités vivantes par EntityType
+
+    // Occupation d'une case (libre si possible, sinon en fin de tableaux)
+    size_t Place(EntityType entityType, Vector2D position, Vector2D velocity, float initialEnergy,
+                 float maximumEnergy, float initialAge, float maximumAge, float entitySize,
+                 Color entityColor, uint64_t entityId, uint64_t parent);
+};
+
+} // namespace Core
+} // namespace Ecosystem
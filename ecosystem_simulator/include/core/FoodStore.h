@@ -0,0 +1,120 @@
+#pragma once
+#include "Structs.h"
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🔖 POIGNÉE DE NOURRITURE
+// Reste valide tant que l'élément existe ; une fois consommé, la case peut
+// accueillir un autre élément mais avec une génération différente : une
+// poignée périmée est détectée au lieu de désigner le nouvel occupant.
+struct FoodHandle {
+    uint32_t slot = 0;
+    uint32_t generation = 0;        // 0 = poignée vide
+
+    bool IsNull() const { return generation == 0; }
+};
+
+// 🍎 STOCKAGE DE LA NOURRITURE AU SOL
+// Tableau dense (parcours et rendu sans trous), retrait par échange avec le
+// dernier élément, et index spatial tenu à jour à chaque ajout ou retrait :
+// la nourriture ne bouge pas, rien n'est reconstruit d'un tick à l'autre.
+// Ajout, retrait et accès par poignée sont en O(1) ; une requête ne visite
+// que les cellules couvrant son rayon.
+//
+// L'ordre du tableau dense ne dépend que de la suite des ajouts et retraits,
+// et les égalités de distance sont départagées par l'indice dense : un monde
+// rechargé (éléments réinsérés dans l'ordre dense) répond comme l'original.
+class FoodStore {
+public:
+    // 🏗 CONSTRUCTEUR
+    FoodStore(float worldWidth = 0.0f, float worldHeight = 0.0f, float cellSize = 150.0f);
+
+    // ⚙ GESTION
+    void Resize(float worldWidth, float worldHeight, float cellSize);  // Réindexe les éléments présents
+    FoodHandle Add(const Food& food);
+    bool Remove(FoodHandle handle);         // false si déjà consommée
+    void Clear();
+    void Reserve(size_t capacity);
+
+    // 🔍 ACCÈS
+    bool IsValid(FoodHandle handle) const {
+        return handle.slot < mSlots.size() && mSlots[handle.slot].generation == handle.generation &&
+               mSlots[handle.slot].dense != FreeSlot;
+    }
+    const Food& Get(FoodHandle handle) const { return mItems[mSlots[handle.slot].dense]; }
+    FoodHandle GetHandle(size_t denseIndex) const {
+        return {mDenseSlot[denseIndex], mSlots[mDenseSlot[denseIndex]].generation};
+    }
+    size_t Size() const { return mItems.size(); }
+    bool Empty() const { return mItems.empty(); }
+    const std::vector<Food>& GetItems() const { return mItems; }   // Ordre dense
+
+    // 🔍 REQUÊTES SPATIALES
+    // Élément le plus proche dans le rayon, ou poignée vide
+    FoodHandle FindNearest(Vector2D center, float radius) const;
+    // Appelle fn(const Food&) pour chaque élément du rectangle [minX, maxX] x [minY, maxY]
+    template <typename Fn>
+    void QueryRect(float minX, float minY, float maxX, float maxY, Fn&& fn) const;
+
+private:
+    static constexpr uint32_t FreeSlot = 0xFFFFFFFFu;
+
+    // CASE STABLE : lien entre une poignée, le tableau dense et la cellule
+    struct Slot {
+        uint32_t generation;
+        uint32_t dense;             // FreeSlot si la case est libre
+        uint32_t cell;
+        uint32_t cellPosition;      // Rang dans mCells[cell]
+    };
+
+    // ENTRÉE DE CELLULE : position copiée pour que les requêtes restent dans la cellule
+    struct CellEntry {
+        Vector2D position;
+        uint32_t slot;
+    };
+
+    // DONNÉES INTERNES
+    std::vector<Food> mItems;               // Dense
+    std::vector<uint32_t> mDenseSlot;       // Case de chaque élément dense
+    std::vector<Slot> mSlots;
+    std::vector<uint32_t> mFreeSlots;       // Pile : la dernière case libérée est réoccupée en premier
+    std::vector<std::vector<CellEntry>> mCells;     // Capacités conservées : aucune allocation en régime établi
+
+    float mCellSize;
+    float mInverseCellSize;
+    int mColumns;
+    int mRows;
+
+    // MÉTHODES PRIVÉES
+    int CellX(float x) const;
+    int CellY(float y) const;
+    void IndexSlot(uint32_t slot, Vector2D position);
+};
+
+// 🔲 PARCOURS DES CELLULES COUVRANT LE RECTANGLE
+template <typename Fn>
+void FoodStore::QueryRect(float minX, float minY, float maxX, float maxY, Fn&& fn) const {
+    if (mItems.empty() || minX > maxX || minY > maxY) return;
+
+    const int firstColumn = CellX(minX);
+    const int lastColumn = CellX(maxX);
+    const int firstRow = CellY(minY);
+    const int lastRow = CellY(maxY);
+
+    for (int cy = firstRow; cy <= lastRow; ++cy) {
+        for (int cx = firstColumn; cx <= lastColumn; ++cx) {
+            for (const CellEntry& entry : mCells[cy * mColumns + cx]) {
+                // Les cellules du bord regroupent aussi ce qui déborde du monde : test exact
+                if (entry.position.x < minX || entry.position.x > maxX ||
+                    entry.position.y < minY || entry.position.y > maxY) continue;
+                fn(mItems[mSlots[entry.slot].dense]);
+            }
+        }
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -1,43 +1,144 @@
 #pragma once
 #include "Core/GameEngine.h"
 #include "Graphics/Window.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/Camera.h"
 #include "Ecosystem.h"
+#include "ReplayLog.h"
+#include "RenderFrame.h"
+#include "TripleBuffer.h"
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace Ecosystem {
 namespace Core {
 
+// 🎮 MOTEUR FENÊTRÉ : DEUX THREADS
+// - Thread principal (rendu) : événements SDL, caméra, dessin de la dernière
+//   image publiée, présentation. SDL impose que la fenêtre et son renderer
+//   restent sur le thread qui les a créés.
+// - Thread de simulation : commandes du joueur, ticks à pas fixe, publication
+//   d'une RenderFrame après chaque série de ticks.
+// Les images passent par un TripleBuffer sans verrou : chaque thread va à son
+// rythme. Images perdues (publiées mais jamais dessinées) et dupliquées
+// (dessinées sans image neuve) sont comptées et affichées dans le titre.
+// Les entrées qui modifient le monde sont des commandes, appliquées par le
+// thread de simulation entre deux ticks (même ordre que dans le journal de rejeu).
 class GameEngine {
+public:
+    // 📨 COMMANDES DU JOUEUR (thread principal → thread de simulation)
+    enum class Command : uint8_t {
+        Reset,
+        SpawnFood,
+        TogglePause,
+        SpeedUp,
+        SlowDown,
+        SaveSnapshot,
+        LoadSnapshot,
+        RefreshFrame        // Republier l'image (superposition du profileur activée en pause)
+    };
+
 private:
     // 🔒 ÉTAT DU MOTEUR
     Graphics::Window mWindow;
-    Ecosystem mEcosystem;
-    bool mIsRunning;
+    Graphics::Renderer mRenderer;
+    Graphics::Camera mCamera;
+    Ecosystem mEcosystem;               // Thread de simulation seulement, une fois Run() lancé
+    std::atomic<bool> mIsRunning;
     bool mIsPaused;
     float mTimeScale;
+
+    // 🧵 THREADS ET ÉCHANGES
+    std::thread mSimulationThread;
+    TripleBuffer<RenderFrame> mFrames;
+    std::mutex mCommandMutex;                       // Protège seulement mPendingCommands
+    std::vector<Command> mPendingCommands;
+    std::vector<Command> mAppliedCommands;          // Tampon du thread de simulation
+    std::atomic<bool> mShowProfiler;                // Superposition min / moyenne / p99 (touche P)
+    std::atomic<int64_t> mPendingRenderNs;          // Rendu depuis le dernier tick, versé au profileur
+
+    // 🎥 VUE DE LA CAMÉRA (écrite par le rendu à chaque image, lue par la simulation)
+    // Bornes indépendantes : un mélange de deux vues successives est couvert par la marge de copie
+    std::atomic<float> mViewMinX;
+    std::atomic<float> mViewMinY;
+    std::atomic<float> mViewMaxX;
+    std::atomic<float> mViewMaxY;
+    RenderFrame::Region mCapturedRegion;            // Zone de la dernière image publiée (simulation)
+
+    // 🖼 CÔTÉ RENDU
+    uint64_t mFramesReceived;
+    uint64_t mDuplicatedFrames;
+    float mCameraWorldWidth;                        // Monde auquel la caméra est ajustée
+    float mCameraWorldHeight;
     
-    // ⏱ CHRONOMÉTRE
+    // ⏱ CHRONOMÉTRE (thread de simulation)
     std::chrono::high_resolution_clock::time_point mLastUpdateTime;
     float mAccumulatedTime;
 
+    // ⏱ PAS FIXE : l'accélération ajoute des ticks, jamais des ticks plus longs
+    static constexpr float FixedTimeStep = 1.0f / 60.0f;
+    static constexpr float MaxFrameTime = 0.25f;    // Au-delà, la pause est ignorée
+    static constexpr float PausedPollInterval = 0.01f;  // Attente des commandes en pause
+
+    // 🎥 ZONE COPIÉE : vue + marge (plus grande entité, barre d'énergie, déplacement depuis
+    // la grille) + une part de la vue de chaque côté, pour suivre la caméra jusqu'à l'image suivante
+    static constexpr float CaptureMargin = 24.0f;
+    static constexpr float CapturePadding = 0.25f;
+    int mMaxSubstepsPerFrame;                       // Budget de rattrapage par image publiée
+    int mSubstepsLastFrame;
+    float mAverageSubsteps;                         // Ticks de simulation par image publiée (moyenne glissante)
+    float mDroppedSimulationTime;                   // Temps abandonné faute de budget
+    float mReadoutTimer;
+    float mStatsTimer;                              // Résumé des populations dans le journal
+
+    // 💾 INSTANTANÉ RAPIDE (F5 : sauvegarde, F9 : chargement)
+    std::string mSnapshotPath;
+
+    // ⏺ JOURNAL DE REJEU (entrées qui agissent sur la simulation, empreintes de l'état)
+    ReplayRecorder mReplayRecorder;
+
 public:
     // 🏗 CONSTRUCTEUR
-    GameEngine(const std::string& title, float width, float height);
+    // La taille du monde est indépendante de celle de la fenêtre (0 = celle de la fenêtre)
+    GameEngine(const std::string& title, float windowWidth, float windowHeight,
+               float worldWidth = 0.0f, float worldHeight = 0.0f);
     
     // ⚙️ MÉTHODES PRINCIPALES
     bool Initialize();
-    void Run();
+    void Run();                                     // Rendu ici, simulation sur son thread jusqu'à la sortie
     void Shutdown();
+    bool StartProfileCsv(const std::string& path);  // Une ligne de durées par tick
+    bool StartStatistics(const std::string& path, const std::string& csvPath);   // Série temporelle par tick
+    bool LoadSnapshot(const std::string& path);     // Avant Run ; ensuite, Command::LoadSnapshot
+    void SetSeed(uint64_t seed);                    // Avant Initialize
+    bool StartRecording(const std::string& path, uint32_t checkpointInterval);  // Avant Initialize
     
     // 🎮 GESTION D'ÉVÉNEMENTS
     void HandleEvents();
     void HandleInput(SDL_Keycode key);
+    void HandleMouse(const SDL_Event& event);
+    void PostCommand(Command command);
 
 private:
-    // 🔐 MÉTHODES INTERNES
+    // 🔐 MÉTHODES INTERNES - THREAD DE SIMULATION
+    void SimulationLoop();
+    bool ApplyCommands();                           // true si au moins une commande
     void Update(float deltaTime);
-    void Render();
-    void RenderUI();
+    int RunFixedSteps(float frameTime);
+    void PublishFrame();
+    RenderFrame::Region GetRequestedRegion() const; // Vue de la caméra, avec la marge de copie
+    void ResetWorld();                              // Initialize (démarrage et touche R)
+
+    // 🔐 MÉTHODES INTERNES - THREAD DE RENDU
+    void Render(const RenderFrame& frame, float alpha);
+    void RenderUI(const RenderFrame& frame);
+    void UpdateTitle(const RenderFrame& frame);
+    void PublishView();                             // Rectangle visible de la caméra → simulation
 };
 
 } // namespace Core
@@ -0,0 +1,95 @@
+#pragma once
+#include "Ecosystem.h"
+#include "ReplayLog.h"
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace Ecosystem {
+namespace Core {
+
+// ⚙ PARAMÈTRES D'UNE SIMULATION SANS FENÊTRE
+struct HeadlessConfig {
+    float worldWidth = 1200.0f;
+    float worldHeight = 800.0f;
+    int maxEntities = 500;
+    int initialHerbivores = 20;
+    int initialCarnivores = 5;
+    int initialPlants = 30;
+    float tickDuration = 1.0f / 60.0f;  // Pas de simulation (secondes simulées)
+    long long maxTicks = 0;             // 0 = pas de limite en ticks
+    float maxSimulatedTime = 0.0f;      // 0 = pas de limite en temps simulé
+    uint64_t seed = 0;                  // 0 = graine aléatoire
+    int threadCount = 0;                // 0 = tous les cœurs (sans effet sur les résultats)
+    std::string profileCsvPath;         // Vide = pas d'export des durées par tick
+    std::string loadSnapshotPath;       // Non vide : reprise de ce monde au lieu de Initialize
+    std::string saveSnapshotPath;       // Non vide : monde final sauvegardé ici
+    std::string statisticsPath;         // Non vide : statistiques de chaque tick (binaire en colonnes)
+    std::string statisticsCsvPath;      // Non vide : les mêmes en CSV
+    std::string recordPath;             // Non vide : journal de rejeu (graine, événements, empreintes)
+    uint32_t checkpointInterval = 600;  // Ticks entre deux empreintes du journal (0 = début et fin seulement)
+    SpeciesTable species = SpeciesTable::Defaults();    // Ignorée au rejeu et à la reprise d'un instantané
+};
+
+// 🖥 MOTEUR HEADLESS
+// Exécute Ecosystem::Update aussi vite que possible, sans SDL ni attente,
+// jusqu'à atteindre le nombre de ticks ou le temps simulé demandé.
+// Avec un journal de rejeu, le monde et ses événements viennent du journal et
+// chaque empreinte enregistrée est comparée à celle du monde rejoué.
+class HeadlessRunner {
+public:
+    // 📊 RÉSULTAT D'UNE EXÉCUTION
+    struct Result {
+        long long ticks;
+        double simulatedSeconds;
+        double wallSeconds;
+        double ticksPerSecond;
+        bool snapshotFailed;            // Reprise ou sauvegarde demandée mais impossible
+        // Rejeu : empreintes comparées, divergences, premier tick divergent (-1 si aucun)
+        long long checkpointsVerified;
+        long long checkpointMismatches;
+        long long firstMismatchTick;
+        Ecosystem::Statistics finalStatistics;
+        int finalEntityCount;
+        // Trajectoire : premier tick sans herbivore / carnivore (-1 si jamais), population extrême
+        long long herbivoreExtinctionTick;
+        long long carnivoreExtinctionTick;
+        int minimumPopulation;
+        int maximumPopulation;
+        // Allocations (si ECOSYSTEM_TRACK_ALLOCATIONS) : total, puis seconde moitié de l'exécution
+        uint64_t allocations;
+        uint64_t steadyStateAllocations;
+        long long steadyStateTicks;
+        // Durées par phase sur les derniers ticks (si ECOSYSTEM_PROFILE)
+        std::array<Profiler::Summary, Profiler::PhaseCount> phases;
+    };
+
+private:
+    // 🔒 ÉTAT
+    HeadlessConfig mConfig;
+    Ecosystem mEcosystem;
+    const ReplayLog* mReplay;           // Non nul : rejeu de ce journal
+    ReplayRecorder mRecorder;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    // Rejeu : config doit reprendre l'en-tête du journal (voir ApplyReplayHeader), qui doit survivre à Run()
+    explicit HeadlessRunner(const HeadlessConfig& config, const ReplayLog* replay = nullptr);
+    // Monde, graine, pas de temps et durée du journal reportés dans la configuration
+    static void ApplyReplayHeader(const ReplayLog& replay, HeadlessConfig& config);
+
+    // ⚙️ EXÉCUTION
+    Result Run();
+    static void PrintReport(const Result& result);
+
+    // GETTERS
+    const Ecosystem& GetEcosystem() const { return mEcosystem; }
+
+private:
+    // MÉTHODES PRIVÉES
+    bool ApplyReplayEvent(const ReplayEvent& event, Result& result);
+    void TrackPopulation(Result& result) const;
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,84 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🧵 SYSTÈME DE TÂCHES À VOL DE TRAVAIL
+// Un pool de threads où chaque travailleur possède sa file : il dépile ses
+// propres tranches par l'arrière et, à court de travail, vole les tranches
+// des autres par l'avant. Le thread appelant participe à ParallelFor.
+//
+// Le découpage en tranches ne dépend que de chunkSize, jamais du nombre de
+// threads : un appelant qui indexe ses résultats par tranche obtient le même
+// résultat quel que soit l'ordonnancement.
+class JobSystem {
+public:
+    // Fonction exécutée pour chaque tranche [begin, end) d'indice chunkIndex
+    // Capture de 16 octets au plus (this et un pointeur vers un contexte sur la pile) :
+    // au-delà, std::function alloue à chaque appel, donc à chaque tick
+    using ChunkFunction = std::function<void(size_t chunkIndex, size_t begin, size_t end)>;
+
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    // threadCount inclut le thread appelant ; 0 = nombre de cœurs de la machine
+    explicit JobSystem(int threadCount = 1);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // ⚙ EXÉCUTION PARALLÈLE (bloquante)
+    void ParallelFor(size_t count, size_t chunkSize, const ChunkFunction& function);
+
+    // GETTERS
+    int GetThreadCount() const { return static_cast<int>(mQueues.size()); }
+    static size_t ChunkCount(size_t count, size_t chunkSize) { return (count + chunkSize - 1) / chunkSize; }
+
+private:
+    // LOT EN COURS : une seule invocation de ParallelFor
+    struct Batch {
+        const ChunkFunction* function;
+        size_t count;
+        size_t chunkSize;
+        std::atomic<size_t> remaining;
+    };
+
+    // TÂCHE : une tranche d'un lot
+    struct Task {
+        Batch* batch;
+        size_t chunkIndex;
+    };
+
+    // FILE D'UN TRAVAILLEUR : le propriétaire dépile à la fin, les voleurs avancent head
+    struct WorkQueue {
+        std::mutex mutex;
+        std::vector<Task> tasks;
+        size_t head = 0;
+    };
+
+    // DONNÉES INTERNES
+    std::vector<std::unique_ptr<WorkQueue>> mQueues;   // [0] = thread appelant
+    std::vector<std::thread> mWorkers;
+    std::mutex mSleepMutex;
+    std::condition_variable mWakeCondition;
+    std::condition_variable mDoneCondition;
+    std::atomic<size_t> mPendingTasks;
+    bool mStopping;
+
+    // MÉTHODES PRIVÉES
+    void WorkerLoop(size_t queueIndex);
+    bool TryRunOne(size_t queueIndex);
+    bool PopLocal(size_t queueIndex, Task& task);
+    bool Steal(size_t thiefIndex, Task& task);
+    void Execute(const Task& task);
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,59 @@
+#pragma once
+#include "Entity.h"
+#include "EntityStore.h"
+#include "SpeciesTraits.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+
+// ⚡ NOYAUX VECTORISÉS DU CYCLE DE VIE
+// Les passes sans aléatoire (dépense d'énergie, vieillissement, intégration
+// des positions, détection des morts) parcourent les colonnes de
+// EntityStore 8 entités à la fois (AVX2) ou 4 (SSE2), avec un repli scalaire.
+// Le jeu d'instructions est choisi à l'exécution selon le processeur.
+//
+// Les constantes par type viennent de tables indexées par EntityType, sans
+// branchement (la dépense d'énergie est fournie par l'appelant : SpeciesTable). Toutes les variantes font les mêmes opérations dans le même
+// ordre, et les entités masquées sont recopiées telles quelles : les
+// résultats sont identiques au bit près d'un jeu d'instructions à l'autre
+// (tant que le compilateur ne fusionne pas les multiplications-additions,
+// cf. -ffp-contract=off avec -mfma).
+// -DECOSYSTEM_NO_SIMD force le chemin scalaire.
+class LifeCycleKernels {
+public:
+    // JEUX D'INSTRUCTIONS
+    enum class InstructionSet : uint8_t {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    // 📋 TABLES PAR TYPE (indice = EntityType)
+    static constexpr std::array<uint8_t, SpeciesCount> IsMobile =                          // SpeciesTraits<Species>::IsMobile
+        MakeSpeciesTable<uint8_t>([](auto species) { return SpeciesTraits<decltype(species)>::IsMobile; });
+
+    // CONSTANTES COMMUNES
+    static constexpr float AgingRate = 10.0f;           // Unités d'âge par seconde simulée
+    static constexpr float MovementScale = 20.0f;       // Unités parcourues par seconde à vitesse 1
+    static constexpr float MovementEnergyCost = 0.1f;   // Énergie par unité de vitesse et par seconde
+
+    // ⚙ PASSES SUR [begin, end)
+    // drainPerSecond : énergie dépensée par seconde, par type (négatif : produite)
+    static void ConsumeEnergy(EntityStore& store, size_t begin, size_t end, float deltaTime,
+                              const std::array<float, SpeciesCount>& drainPerSecond);
+    static void Age(EntityStore& store, size_t begin, size_t end, float deltaTime);
+    static void Integrate(EntityStore& store, size_t begin, size_t end, float deltaTime);   // Position + coût du mouvement
+    static void CollectDeaths(const EntityStore& store, size_t begin, size_t end, LifeCycleCommands& commands);
+
+    // 🧭 SÉLECTION DU JEU D'INSTRUCTIONS
+    static InstructionSet Detect();                         // Le meilleur supporté par ce processeur
+    static InstructionSet GetActive();
+    static bool SetActive(InstructionSet instructionSet);   // false si non supporté (mesures, comparaisons)
+    static const char* GetName(InstructionSet instructionSet);
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,156 @@
+#pragma once
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+// 📝 NIVEAU DE JOURNALISATION À LA COMPILATION
+// 0 = Trace, 1 = Debug, 2 = Info, 3 = Warning, 4 = Error, 5 = rien.
+// Les messages sous ce niveau sont retirés par le préprocesseur : ni code,
+// ni évaluation des arguments. Exemple : -DECOSYSTEM_LOG_LEVEL=1 pour les
+// événements par entité (naissances, repas, morts).
+#ifndef ECOSYSTEM_LOG_LEVEL
+#define ECOSYSTEM_LOG_LEVEL 2
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+// NIVEAUX
+enum class LogLevel : uint8_t {
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error
+};
+
+// 📬 JOURNAL ASYNCHRONE
+// Les producteurs (n'importe quel thread) déposent leurs lignes dans un
+// anneau borné sans verrou ; un thread de fond les écrit sur la console.
+// Si l'anneau est plein, la ligne est comptée comme perdue plutôt que de
+// bloquer la simulation.
+class Logger {
+public:
+    static constexpr size_t MaxMessageLength = 244;
+    static constexpr size_t Capacity = 8192;        // Puissance de deux
+
+    // ACCÈS GLOBAL (le thread de fond démarre au premier message)
+    static Logger& Instance();
+
+    // 🏗 DESTRUCTEUR : vide l'anneau avant de s'arrêter
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // ⚙ PRODUCTION / CONSOMMATION
+    void Push(LogLevel level, const char* text, size_t length);
+    void Flush();       // Attend que toutes les lignes déposées soient écrites
+
+    // GETTERS
+    uint64_t GetDroppedCount() const { return mDropped.load(std::memory_order_relaxed); }
+
+private:
+    // CASE DE L'ANNEAU (file MPSC bornée à numéros de séquence)
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogLevel level;
+        uint8_t length;
+        char text[MaxMessageLength];
+    };
+
+    // DONNÉES INTERNES
+    std::unique_ptr<Slot[]> mSlots;
+    alignas(64) std::atomic<size_t> mEnqueuePosition;
+    alignas(64) size_t mDequeuePosition;            // Seul le thread de fond y touche
+    std::atomic<size_t> mWritten;
+    std::atomic<uint64_t> mDropped;
+    std::atomic<bool> mStopping;
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    std::condition_variable mFlushedCondition;
+    std::thread mWriter;
+
+    // CONSTRUCTEUR PRIVÉ
+    Logger();
+
+    // MÉTHODES PRIVÉES
+    void WriterLoop();
+    bool WriteOne();
+};
+
+// 🧾 LIGNE EN COURS DE COMPOSITION
+// Formatée dans un tampon local (aucune allocation), déposée à la destruction.
+class LogLine {
+public:
+    explicit LogLine(LogLevel level) : mLevel(level), mLength(0) {}
+    ~LogLine() { Logger::Instance().Push(mLevel, mBuffer, mLength); }
+
+    LogLine(const LogLine&) = delete;
+    LogLine& operator=(const LogLine&) = delete;
+
+    LogLine& operator<<(const char* text);
+    LogLine& operator<<(const std::string& text) { Append(text.data(), text.size()); return *this; }
+    LogLine& operator<<(char character) { Append(&character, 1); return *this; }
+    LogLine& operator<<(double value);
+
+    template <typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char>, int> = 0>
+    LogLine& operator<<(T value) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        Append(digits, static_cast<size_t>(result.ptr - digits));
+        return *this;
+    }
+
+private:
+    LogLevel mLevel;
+    size_t mLength;
+    char mBuffer[Logger::MaxMessageLength];
+
+    void Append(const char* text, size_t length);
+};
+
+} // namespace Core
+} // namespace Ecosystem
+
+// 🔧 MACROS DE JOURNALISATION
+// Usage : ECO_LOG_INFO("Entités: " << count << " à " << x);
+#define ECO_LOG_EMIT(level, message) \
+    do { ::Ecosystem::Core::LogLine ecoLogLine(level); ecoLogLine << message; } while (0)
+
+#if ECOSYSTEM_LOG_LEVEL <= 0
+#define ECO_LOG_TRACE(message) ECO_LOG_EMIT(::Ecosystem::Core::LogLevel::Trace, message)
+#else
+#define ECO_LOG_TRACE(message) ((void)0)
+#endif
+
+#if ECOSYSTEM_LOG_LEVEL <= 1
+#define ECO_LOG_DEBUG(message) ECO_LOG_EMIT(::Ecosystem::Core::LogLevel::Debug, message)
+#else
+#define ECO_LOG_DEBUG(message) ((void)0)
+#endif
+
+#if ECOSYSTEM_LOG_LEVEL <= 2
+#define ECO_LOG_INFO(message) ECO_LOG_EMIT(::Ecosystem::Core::LogLevel::Info, message)
+#else
+#define ECO_LOG_INFO(message) ((void)0)
+#endif
+
+#if ECOSYSTEM_LOG_LEVEL <= 3
+#define ECO_LOG_WARNING(message) ECO_LOG_EMIT(::Ecosystem::Core::LogLevel::Warning, message)
+#else
+#define ECO_LOG_WARNING(message) ((void)0)
+#endif
+
+#if ECOSYSTEM_LOG_LEVEL <= 4
+#define ECO_LOG_ERROR(message) ECO_LOG_EMIT(::Ecosystem::Core::LogLevel::Error, message)
+#else
+#define ECO_LOG_ERROR(message) ((void)0)
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🗺 FICHIER PROJETÉ EN MÉMOIRE (lecture seule)
+// mmap sous POSIX, CreateFileMapping sous Windows. Le système charge les
+// pages à la demande : ouvrir un fichier de plusieurs centaines de Mo ne
+// coûte presque rien, seules les pages lues sont réellement transférées.
+class MappedFile {
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // ⚙ PROJECTION
+    bool Open(const std::string& path);     // false si absent, vide ou non projetable
+    void Close();
+
+    // GETTERS
+    const uint8_t* GetData() const { return mData; }
+    size_t GetSize() const { return mSize; }
+    bool IsOpen() const { return mData != nullptr; }
+
+private:
+    const uint8_t* mData;
+    size_t mSize;
+#ifdef _WIN32
+    void* mFileHandle;
+    void* mMappingHandle;
+#endif
+};
+
+} // namespace Core
+} // namespace Ecosystem
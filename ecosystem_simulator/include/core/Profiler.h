@@ -0,0 +1,124 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// ⏱ PROFILAGE PAR PHASE À LA COMPILATION
+// 1 (défaut) = chaque phase de Ecosystem::Update et le rendu sont chronométrés.
+// 0 = les macros ECO_PROFILE_* disparaissent : ni lecture d'horloge, ni appel,
+// le profileur reste vide (surcoût nul). Exemple : -DECOSYSTEM_PROFILE=0
+#ifndef ECOSYSTEM_PROFILE
+#define ECOSYSTEM_PROFILE 1
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+// PHASES CHRONOMÉTRÉES
+enum class ProfilePhase : uint8_t {
+    RemoveDeadEntities,
+    UpdateEntities,
+    SpatialIndex,
+    Behaviors,
+    Eating,
+    Reproduction,
+    PlantGrowth,
+    Statistics,
+    Tick,           // Ecosystem::Update complet (clôt la ligne CSV du tick)
+    Render,         // GameEngine::Render (images depuis le tick précédent)
+    Count
+};
+
+// 📊 PROFILEUR DE TICK
+// Garde, pour chaque phase, les dernières mesures dans une fenêtre glissante
+// et en tire min / moyenne / p99 à la demande. Chaque Ecosystem a le sien :
+// plusieurs mondes peuvent tourner en parallèle sans état partagé.
+// Optionnellement, chaque tick devient une ligne d'un fichier CSV.
+class Profiler {
+public:
+    static constexpr bool Enabled = ECOSYSTEM_PROFILE != 0;
+    static constexpr size_t PhaseCount = static_cast<size_t>(ProfilePhase::Count);
+    static constexpr size_t WindowSize = 256;       // ~4 s à 60 ticks/s
+
+    // RÉSUMÉ D'UNE PHASE SUR LA FENÊTRE (ms)
+    struct Summary {
+        double minimumMs;
+        double averageMs;
+        double p99Ms;
+        double lastMs;
+        uint32_t samples;
+    };
+
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    Profiler();
+    ~Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // ⚙ MESURES
+    void Record(ProfilePhase phase, int64_t nanoseconds);
+    void Reset();
+
+    // 📝 EXPORT CSV : une ligne par tick, une colonne par phase (ms)
+    bool OpenCsv(const std::string& path);      // false si impossible ou profilage désactivé
+    void CloseCsv();
+    bool IsCsvOpen() const { return mCsv != nullptr; }
+
+    // GETTERS
+    Summary GetSummary(ProfilePhase phase) const;
+    double GetLastMs(ProfilePhase phase) const { return mLastMs[Index(phase)]; }
+    uint64_t GetTickCount() const { return mTickCount; }
+    static const char* GetName(ProfilePhase phase);
+
+private:
+    // FENÊTRE GLISSANTE PAR PHASE
+    std::array<std::array<float, WindowSize>, PhaseCount> mSamples;
+    std::array<uint32_t, PhaseCount> mSampleCount;
+    std::array<uint32_t, PhaseCount> mNextSample;
+    std::array<double, PhaseCount> mLastMs;
+
+    // LIGNE CSV EN COURS (cumul par phase depuis le tick précédent)
+    std::array<double, PhaseCount> mPendingMs;
+    uint64_t mTickCount;
+    FILE* mCsv;
+
+    // MÉTHODES PRIVÉES
+    static size_t Index(ProfilePhase phase) { return static_cast<size_t>(phase); }
+    void CommitTick();
+};
+
+// ⏲ MESURE D'UNE PORTÉE : de la construction à la destruction
+class ProfileScope {
+public:
+    ProfileScope(Profiler& profiler, ProfilePhase phase)
+        : mProfiler(profiler), mPhase(phase), mStart(std::chrono::steady_clock::now()) {}
+    ~ProfileScope() {
+        const auto elapsed = std::chrono::steady_clock::now() - mStart;
+        mProfiler.Record(mPhase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler& mProfiler;
+    ProfilePhase mPhase;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+} // namespace Core
+} // namespace Ecosystem
+
+// 🔌 MACRO D'INSTRUMENTATION (une par portée)
+#define ECO_PROFILE_CONCAT_INNER(a, b) a##b
+#define ECO_PROFILE_CONCAT(a, b) ECO_PROFILE_CONCAT_INNER(a, b)
+
+#if ECOSYSTEM_PROFILE
+#define ECO_PROFILE_SCOPE(profiler, phase) \
+    ::Ecosystem::Core::ProfileScope ECO_PROFILE_CONCAT(ecoProfileScope, __LINE__)((profiler), (phase))
+#else
+#define ECO_PROFILE_SCOPE(profiler, phase) ((void)0)
+#endif
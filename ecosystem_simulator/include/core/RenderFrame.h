@@ -0,0 +1,71 @@
+#pragma once
+#include "Ecosystem.h"
+#include "Profiler.h"
+#include "Structs.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🖼 IMAGE DU MONDE POUR LE RENDU
+// Copie figée de tout ce que le rendu lit, publiée par le thread de simulation
+// (TripleBuffer) : le thread de rendu dessine sans jamais toucher à l'Ecosystem.
+// Seules les entités vivantes de la zone demandée par la caméra (avec marge)
+// sont copiées, en colonnes comme dans EntityStore : la copie passe par les
+// grilles spatiales et coûte ce qui est visible, pas la population entière.
+struct RenderFrame {
+    // 🎥 ZONE DU MONDE (bornes incluses)
+    struct Region {
+        float minX = 0.0f;
+        float minY = 0.0f;
+        float maxX = 0.0f;
+        float maxY = 0.0f;
+
+        bool Contains(const Region& other) const {
+            return other.minX >= minX && other.maxX <= maxX && other.minY >= minY && other.maxY <= maxY;
+        }
+    };
+
+    // 🐾 ENTITÉS VIVANTES (même indice dans toutes les colonnes)
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> previousPositionX;   // Début du dernier tick (interpolation)
+    std::vector<float> previousPositionY;
+    std::vector<float> size;
+    std::vector<float> energyRatio;         // energy / maxEnergy
+    std::vector<Color> color;               // Couleur de l'espèce, sans la teinte d'énergie
+    std::vector<EntityType> type;
+
+    // 🍎 NOURRITURE (de la zone copiée)
+    std::vector<Food> food;
+
+    // 🌍 MONDE
+    Region region;                          // Zone copiée : rien n'est connu au-delà
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+    uint32_t tick = 0;
+    int entityCount = 0;                    // Tout le monde, pas seulement la zone copiée
+
+    // ⏱ BOUCLE DE SIMULATION AU MOMENT DE LA PUBLICATION
+    std::chrono::steady_clock::time_point publishedAt;
+    float pendingTime = 0.0f;               // Temps accumulé pas encore simulé (< un pas)
+    float timeScale = 1.0f;
+    bool paused = false;
+    float averageSubsteps = 0.0f;           // Ticks par image publiée (moyenne glissante)
+    float droppedSimulationTime = 0.0f;
+
+    // 📊 PROFILAGE (copié seulement quand la superposition est affichée)
+    bool hasProfile = false;
+    std::array<Profiler::Summary, Profiler::PhaseCount> profile = {};
+
+    // 📸 COPIE DES ENTITÉS ET DE LA NOURRITURE DE LA ZONE, ET DU MONDE (le reste est rempli par l'appelant)
+    // Les colonnes gardent leur capacité : aucune allocation une fois la vue stabilisée
+    void Capture(const Ecosystem& ecosystem, const Region& area);
+    size_t GetEntityCount() const { return positionX.size(); }
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,115 @@
+#pragma once
+#include "Ecosystem.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🎬 JOURNAL DE REJEU
+// Fichier texte : un en-tête (monde, graine, pas de temps), puis une ligne par
+// événement, horodatée en ticks depuis le début de l'enregistrement :
+//
+//   ECOREPLAY 1
+//   world 1200 800 500
+//   seed 1234567890
+//   dt 0.0166666675
+//   checkpoint-interval 600
+//   0 initialize 20 5 30
+//   0 checkpoint 9f2c6a41d07b3e58
+//   412 food 10
+//   600 checkpoint 0c81f5e2a9d4b736
+//   ...
+//   5310 end 5e0b9d7c13a2f468
+//
+// Un événement de tick T s'applique après T appels à Ecosystem::Update, dans
+// l'ordre du fichier. Le pas étant fixe, la pause et la vitesse ne changent que
+// la cadence réelle : elles sont notées pour information, sans effet au rejeu.
+// Chaque ligne est écrite aussitôt : un arrêt brutal laisse un journal rejouable
+// jusqu'au dernier événement.
+enum class ReplayEventType {
+    Initialize,         // values = herbivores, carnivores, plantes
+    SpawnFood,          // values[0] = quantité
+    LoadSnapshot,       // path
+    Pause,              // values[0] = 1 en pause, 0 reprise
+    TimeScale,          // timeScale
+    Checkpoint,         // hash = Ecosystem::ComputeStateHash()
+    End                 // hash de l'état final
+};
+
+struct ReplayEvent {
+    uint64_t tick = 0;
+    ReplayEventType type = ReplayEventType::Checkpoint;
+    int values[3] = {0, 0, 0};
+    float timeScale = 1.0f;
+    uint64_t hash = 0;
+    std::string path;
+};
+
+// ⚙ MONDE DE DÉPART
+struct ReplayHeader {
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+    int maxEntities = 0;
+    uint64_t seed = 0;
+    float tickDuration = 1.0f / 60.0f;
+    uint32_t checkpointInterval = 600;     // 0 = pas de point de contrôle intermédiaire
+};
+
+// 📜 JOURNAL CHARGÉ
+struct ReplayLog {
+    static constexpr int Version = 1;
+
+    ReplayHeader header;
+    std::vector<ReplayEvent> events;        // Triés par tick
+
+    static bool Load(const std::string& path, ReplayLog& log, std::string& error);
+    // Dernier tick du journal (celui de « end », ou du dernier événement si l'enregistrement a été interrompu)
+    uint64_t GetLastTick() const { return events.empty() ? 0 : events.back().tick; }
+    bool IsComplete() const { return !events.empty() && events.back().type == ReplayEventType::End; }
+};
+
+// ⏺ ENREGISTREUR
+// À ouvrir sur un monde neuf (avant son Initialize) : la graine suffit alors à
+// reproduire tous les tirages qui suivent.
+class ReplayRecorder {
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    ReplayRecorder();
+    ~ReplayRecorder();          // Ferme sans ligne « end » si Close() n'a pas été appelé
+
+    ReplayRecorder(const ReplayRecorder&) = delete;
+    ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+
+    // ⚙ CYCLE DE VIE
+    bool Open(const std::string& path, const ReplayHeader& header);
+    void Close(const Ecosystem& ecosystem);         // Ligne « end » avec l'empreinte finale
+    bool IsOpen() const { return mFile != nullptr; }
+
+    // 📥 ÉVÉNEMENTS (sans effet si fermé)
+    // Initialize et LoadSnapshot remplacent le monde : un point de contrôle suit aussitôt
+    void RecordInitialize(int herbivores, int carnivores, int plants, const Ecosystem& ecosystem);
+    void RecordLoadSnapshot(const std::string& path, const Ecosystem& ecosystem);
+    void RecordSpawnFood(int count);
+    void RecordPause(bool paused);
+    void RecordTimeScale(float timeScale);
+    // À appeler après chaque Ecosystem::Update ; point de contrôle tous les checkpointInterval ticks
+    void EndTick(const Ecosystem& ecosystem);
+
+    // GETTERS
+    uint64_t GetTick() const { return mTick; }
+
+private:
+    // DONNÉES INTERNES
+    FILE* mFile;
+    uint64_t mTick;                 // Ticks depuis Open()
+    uint32_t mCheckpointInterval;
+
+    // MÉTHODES PRIVÉES
+    void Write(const ReplayEvent& event);
+};
+
+} // namespace Core
+} // namespace Ecosystem
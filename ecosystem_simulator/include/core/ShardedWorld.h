@@ -0,0 +1,95 @@
+#pragma once
+#include "Ecosystem.h"
+#include "HeadlessRunner.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🗺 DÉCOUPAGE DU MONDE EN ÉCLATS
+// Grille régulière de columns x rows rectangles, numérotés ligne par ligne.
+// Une entité appartient à l'éclat qui contient sa position ramenée dans le
+// monde : celles qui débordent restent à l'éclat du bord.
+struct ShardLayout {
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+    int columns = 1;
+    int rows = 1;
+
+    int GetShardCount() const { return columns * rows; }
+    WorldDomain GetDomain(uint32_t shard) const;
+    uint32_t OwnerOf(Vector2D position) const;
+    int ColumnOf(float x) const;
+    int RowOf(float y) const;
+};
+
+// ⚙ PARAMÈTRES D'UN MONDE RÉPARTI
+struct ShardedConfig {
+    HeadlessConfig world;               // Monde entier : taille, population, graine, durée, espèces
+    int columns = 2;
+    int rows = 1;
+    // Largeur de la zone fantôme : le plus grand rayon de perception entre entités
+    float ghostMargin = Entity::FoodPerceptionRadius;
+    std::string executablePath;         // Binaire relancé pour chaque éclat (--shard-worker)
+};
+
+// 🧩 MONDE RÉPARTI ENTRE PROCESSUS
+// Chaque éclat est un processus local qui possède un Ecosystem limité à son
+// rectangle. Le coordinateur avance tous les éclats du même tick, en phase :
+//
+//   1. il envoie à chaque éclat ses arrivants et ses fantômes ;
+//   2. chaque éclat accueille ses arrivants, fait un Update, puis renvoie les
+//      entités sorties de son rectangle, celles qui sont à moins de ghostMargin
+//      d'un bord, et ses statistiques ;
+//   3. le coordinateur additionne les statistiques et range chaque sortant chez
+//      son nouveau propriétaire, chaque entité de bord chez les voisins dont la
+//      zone fantôme la contient.
+//
+// Les fantômes sont en lecture seule (perception des proies et des prédateurs),
+// avec un tick de retard. La nourriture reste à l'éclat où elle apparaît. Les
+// messages passent par des sockets Unix (socketpair) : remplacer la paire par une
+// connexion TCP suffirait pour répartir les éclats sur plusieurs machines.
+// Un monde 1 x 1 donne exactement la simulation d'un monde seul.
+class ShardCoordinator {
+public:
+    // 📊 RÉSULTAT : celui d'un monde seul, plus les échanges entre éclats
+    struct Result {
+        HeadlessRunner::Result world;
+        long long migrations;           // Entités passées d'un éclat à un autre
+        long long ghostsSent;           // Fantômes transmis, tous ticks confondus
+        std::vector<int> shardEntities; // Population finale de chaque éclat
+        bool failed;                    // Éclat perdu ou impossible à lancer
+    };
+
+private:
+    // 🔒 ÉTAT
+    ShardedConfig mConfig;
+    ShardLayout mLayout;
+    std::vector<int> mSockets;          // Extrémité du coordinateur, une par éclat
+    std::vector<int> mProcesses;        // pid_t des éclats
+
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    explicit ShardCoordinator(const ShardedConfig& config);
+    ~ShardCoordinator();                // Arrête les éclats encore lancés
+
+    ShardCoordinator(const ShardCoordinator&) = delete;
+    ShardCoordinator& operator=(const ShardCoordinator&) = delete;
+
+    // ⚙️ EXÉCUTION
+    Result Run();
+    static void PrintReport(const Result& result);
+
+    // 🧩 CÔTÉ ÉCLAT : boucle d'un processus lancé avec --shard-worker (code de sortie)
+    static int RunWorker(int socket);
+
+private:
+    // MÉTHODES PRIVÉES
+    bool Launch();
+    void Stop();
+};
+
+} // namespace Core
+} // namespace Ecosystem
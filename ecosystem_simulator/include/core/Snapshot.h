@@ -0,0 +1,149 @@
+#pragma once
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 💾 FORMAT D'INSTANTANÉ DU MONDE
+// Fichier binaire plat, dans l'ordre des octets de la machine :
+//   [SnapshotHeader][table de SnapshotSection][colonnes alignées sur 64 octets]
+// Chaque colonne est la copie brute d'un tableau (une colonne de EntityStore,
+// la nourriture...). Le chargement projette le fichier en mémoire et copie
+// chaque colonne d'un bloc : aucune analyse entité par entité.
+// Toute évolution de la disposition incrémente Version.
+
+// IDENTIFIANTS DES COLONNES
+enum class SnapshotSection : uint32_t {
+    PositionX = 1,
+    PositionY,
+    PreviousPositionX,
+    PreviousPositionY,
+    VelocityX,
+    VelocityY,
+    Energy,
+    MaxEnergy,
+    Age,
+    MaxAge,
+    Type,
+    Alive,
+    Id,
+    Size,
+    Color,
+    // 16, 17 : noms des entités (versions 1 et 2), désormais formatés à la demande
+    FreeSlots = 18,     // Pile de cases libres (ordre conservé : même réoccupation)
+    PendingDeaths,
+    Food,
+    DayHistory,         // Ecosystem::DayRecord, de la plus ancienne à la plus récente
+    ParentId,
+    Species             // SpeciesParameters, indice = EntityType (version 4)
+};
+
+// 📋 EN-TÊTE (taille fixe)
+struct SnapshotHeader {
+    static constexpr char Magic[8] = {'E', 'C', 'O', 'S', 'N', 'A', 'P', '\0'};
+    static constexpr uint32_t Version = 4;
+    static constexpr uint32_t ByteOrderMark = 0x01020304u;     // Relu différemment sur une machine d'autre boutisme
+    static constexpr int32_t MaxEntities = 1 << 24;             // Au-delà, en-tête jugé corrompu (réservation démesurée)
+
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t byteOrder;
+    uint32_t sectionCount;
+
+    // MONDE
+    float worldWidth;
+    float worldHeight;
+    int32_t maxEntities;
+    int32_t dayCycle;
+    uint64_t worldSeed;
+    uint64_t nextEntityId;
+    uint32_t worldDraws;
+    uint32_t reserved;
+    uint64_t slotCount;             // Cases de EntityStore (vivantes ou non)
+
+    // STATISTIQUES
+    int32_t totalHerbivores;
+    int32_t totalCarnivores;
+    int32_t totalPlants;
+    int32_t totalFood;
+    int32_t deathsToday;
+    int32_t birthsToday;
+    int32_t totalDeaths;
+    int32_t totalBirths;
+    int32_t minimumPopulationToday;
+    int32_t maximumPopulationToday;
+};
+
+// 📑 ENTRÉE DE LA TABLE DES COLONNES
+struct SnapshotSectionEntry {
+    uint32_t id;
+    uint32_t elementSize;
+    uint64_t offset;                // Depuis le début du fichier
+    uint64_t count;
+};
+
+// ✍ ÉCRITURE : colonnes référencées puis écrites en une passe
+class SnapshotWriter {
+public:
+    static constexpr size_t Alignment = 64;
+
+    explicit SnapshotWriter(const SnapshotHeader& header) : mHeader(header) {}
+
+    // Les données doivent rester valides jusqu'à WriteTo()
+    template <typename T>
+    void AddSection(SnapshotSection id, const T* data, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "colonne non copiable octet par octet");
+        mSections.push_back({{static_cast<uint32_t>(id), static_cast<uint32_t>(sizeof(T)), 0, count}, data});
+    }
+    template <typename T>
+    void AddSection(SnapshotSection id, const std::vector<T>& column) {
+        AddSection(id, column.data(), column.size());
+    }
+
+    bool WriteTo(const std::string& path);
+
+private:
+    struct PendingSection {
+        SnapshotSectionEntry entry;
+        const void* data;
+    };
+    SnapshotHeader mHeader;
+    std::vector<PendingSection> mSections;
+};
+
+// 📖 LECTURE : projection en mémoire, validation des bornes, copies en bloc
+class SnapshotReader {
+public:
+    SnapshotReader() : mHeader(nullptr), mSections(nullptr) {}
+
+    // Vérifie signature, version, boutisme et que chaque colonne tient dans le fichier
+    bool Open(const std::string& path, std::string& error);
+
+    const SnapshotHeader& GetHeader() const { return *mHeader; }
+
+    // Colonne de count éléments de type T, ou nullptr si absente ou incohérente
+    template <typename T>
+    const T* FindSection(SnapshotSection id, size_t count) const {
+        const SnapshotSectionEntry* entry = FindEntry(id);
+        if (!entry || entry->elementSize != sizeof(T) || entry->count != count) return nullptr;
+        return reinterpret_cast<const T*>(mFile.GetData() + entry->offset);
+    }
+    // Nombre d'éléments d'une colonne de taille libre (0 si absente)
+    uint64_t GetSectionCount(SnapshotSection id) const;
+
+private:
+    MappedFile mFile;
+    const SnapshotHeader* mHeader;
+    const SnapshotSectionEntry* mSections;
+
+    const SnapshotSectionEntry* FindEntry(SnapshotSection id) const;
+};
+
+} // namespace Core
+} // namespace Ecosystem
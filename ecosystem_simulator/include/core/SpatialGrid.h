@@ -0,0 +1,147 @@
+#pragma once
+#include "Structs.h"
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🗺 GRILLE SPATIALE UNIFORME
+// Index des positions par cellules carrées, reconstruit à chaque tick par un
+// tri par comptage : les éléments d'une même cellule sont contigus en mémoire.
+// La taille de cellule suit les rayons de perception (80 pour la fuite,
+// 150 pour la recherche de nourriture) pour qu'une requête ne visite que
+// quelques cellules au lieu de toute la population.
+class SpatialGrid {
+public:
+    // ÉLÉMENT INDEXÉ
+    struct Item {
+        Vector2D position;
+        int index;      // Indice dans le conteneur d'origine
+        int tag;        // Catégorie (ex: EntityType) pour les filtres
+    };
+
+    // Masque de catégories accepté par les requêtes
+    static constexpr uint32_t AllTags = 0xFFFFFFFFu;
+    static constexpr uint32_t MaskOf(int tag) { return 1u << tag; }
+
+    // 🏗 CONSTRUCTEUR
+    SpatialGrid(float worldWidth = 0.0f, float worldHeight = 0.0f, float cellSize = 80.0f);
+
+    // ⚙ CONSTRUCTION DE L'INDEX
+    void Resize(float worldWidth, float worldHeight, float cellSize);
+    void Clear();
+    void Insert(Vector2D position, int index, int tag = 0);
+    void Build();
+
+    // 🔍 REQUÊTES
+    // Appelle fn(const Item&, float distanceSquared) pour chaque élément dans le rayon
+    template <typename Fn>
+    void QueryRadius(Vector2D center, float radius, uint32_t tagMask, Fn&& fn) const;
+
+    // Élément le plus proche dans le rayon accepté par le filtre, ou nullptr
+    template <typename Accept>
+    const Item* FindNearest(Vector2D center, float radius, uint32_t tagMask, Accept&& accept) const;
+    const Item* FindNearest(Vector2D center, float radius, uint32_t tagMask = AllTags) const;
+
+    // Appelle fn(const Item&) pour chaque élément du rectangle [minX, maxX] x [minY, maxY]
+    template <typename Fn>
+    void QueryRect(float minX, float minY, float maxX, float maxY, uint32_t tagMask, Fn&& fn) const;
+
+    // GETTERS
+    int GetItemCount() const { return static_cast<int>(mItems.size()); }
+    int GetCellCount() const { return mColumns * mRows; }
+    float GetCellSize() const { return mCellSize; }
+
+private:
+    // DONNÉES INTERNES
+    float mCellSize;
+    float mInverseCellSize;
+    int mColumns;
+    int mRows;
+
+    std::vector<Item> mPending;     // Éléments insérés depuis le dernier Build()
+    std::vector<Item> mItems;       // Éléments triés par cellule
+    std::vector<int> mCellStart;    // Début de chaque cellule dans mItems (+1 sentinelle)
+    std::vector<int> mCellOfPending;
+    std::vector<int> mCellCursor;
+
+    // MÉTHODES PRIVÉES
+    int CellX(float x) const;
+    int CellY(float y) const;
+};
+
+// 🔍 PARCOURS DES CELLULES COUVRANT LE CERCLE
+template <typename Fn>
+void SpatialGrid::QueryRadius(Vector2D center, float radius, uint32_t tagMask, Fn&& fn) const {
+    if (mItems.empty()) return;
+
+    const float radiusSquared = radius * radius;
+    const int minX = CellX(center.x - radius);
+    const int maxX = CellX(center.x + radius);
+    const int minY = CellY(center.y - radius);
+    const int maxY = CellY(center.y + radius);
+
+    for (int cy = minY; cy <= maxY; ++cy) {
+        const int rowStart = cy * mColumns;
+        // Les cellules d'une ligne sont contiguës : un seul intervalle à parcourir
+        const int begin = mCellStart[rowStart + minX];
+        const int end = mCellStart[rowStart + maxX + 1];
+        for (int i = begin; i < end; ++i) {
+            const Item& item = mItems[i];
+            if ((MaskOf(item.tag) & tagMask) == 0) continue;
+            const Vector2D delta = item.position - center;
+            const float distanceSquared = delta.LengthSquared();
+            if (distanceSquared <= radiusSquared) {
+                fn(item, distanceSquared);
+            }
+        }
+    }
+}
+
+// 🎯 PLUS PROCHE VOISIN FILTRÉ
+template <typename Accept>
+const SpatialGrid::Item* SpatialGrid::FindNearest(Vector2D center, float radius, uint32_t tagMask,
+                                                  Accept&& accept) const {
+    const Item* best = nullptr;
+    float bestDistanceSquared = radius * radius;
+    QueryRadius(center, radius, tagMask, [&](const Item& item, float distanceSquared) {
+        // Égalité départagée par l'indice pour rester déterministe
+        if (distanceSquared < bestDistanceSquared ||
+            (best && distanceSquared == bestDistanceSquared && item.index < best->index)) {
+            if (accept(item)) {
+                best = &item;
+                bestDistanceSquared = distanceSquared;
+            }
+        }
+    });
+    return best;
+}
+
+// 🔲 PARCOURS DES CELLULES COUVRANT LE RECTANGLE
+template <typename Fn>
+void SpatialGrid::QueryRect(float minX, float minY, float maxX, float maxY, uint32_t tagMask, Fn&& fn) const {
+    if (mItems.empty() || minX > maxX || minY > maxY) return;
+
+    const int firstColumn = CellX(minX);
+    const int lastColumn = CellX(maxX);
+    const int firstRow = CellY(minY);
+    const int lastRow = CellY(maxY);
+
+    for (int cy = firstRow; cy <= lastRow; ++cy) {
+        const int rowStart = cy * mColumns;
+        const int begin = mCellStart[rowStart + firstColumn];
+        const int end = mCellStart[rowStart + lastColumn + 1];
+        for (int i = begin; i < end; ++i) {
+            const Item& item = mItems[i];
+            if ((MaskOf(item.tag) & tagMask) == 0) continue;
+            // Les cellules du bord regroupent aussi ce qui déborde du monde : test exact
+            if (item.position.x < minX || item.position.x > maxX ||
+                item.position.y < minY || item.position.y > maxY) continue;
+            fn(item);
+        }
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
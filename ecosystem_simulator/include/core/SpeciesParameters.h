@@ -0,0 +1,55 @@
+#pragma once
+#include "EntityStore.h"
+#include "SpeciesTraits.h"
+#include "Structs.h"
+#include <array>
+#include <cstddef>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🧬 CONSTANTES D'UNE ESPÈCE
+// Valeurs d'apparition (Entity::Create) et dépense d'énergie (LifeCycleKernels::ConsumeEnergy).
+// Les enfants héritent de celles de leur parent, pas de la table.
+struct SpeciesParameters {
+    float initialEnergy;
+    float maxEnergy;
+    float maxAge;                       // En unités d'âge (LifeCycleKernels::AgingRate par seconde)
+    float size;
+    float energyDrainPerSecond;         // Négatif : l'espèce produit de l'énergie
+    Color color;
+};
+
+// 📋 TABLE DES ESPÈCES (indice = EntityType)
+// Propre à chaque Ecosystem : des mondes aux réglages différents tournent côte à côte
+// sans rien partager. Sauvegardée dans les instantanés.
+struct SpeciesTable {
+    std::array<SpeciesParameters, SpeciesCount> species;
+
+    const SpeciesParameters& operator[](EntityType type) const { return species[static_cast<size_t>(type)]; }
+    SpeciesParameters& operator[](EntityType type) { return species[static_cast<size_t>(type)]; }
+
+    // Dépense d'énergie de chaque type, au format des noyaux vectorisés
+    std::array<float, SpeciesCount> GetEnergyDrain() const {
+        std::array<float, SpeciesCount> drain;
+        for (size_t type = 0; type < SpeciesCount; ++type) {
+            drain[type] = species[type].energyDrainPerSecond;
+        }
+        return drain;
+    }
+
+    // RÉGLAGES D'ORIGINE (SpeciesTraits<Species>::Defaults)
+    static SpeciesTable Defaults() {
+        SpeciesTable table;
+        ForEachSpecies([&table](auto tag) {
+            using Traits = SpeciesTraits<decltype(tag)>;
+            const SpeciesDefaults& values = Traits::Defaults;
+            table[Traits::Type] = {values.initialEnergy, values.maxEnergy, values.maxAge, values.size,
+                                   values.energyDrainPerSecond, Color(values.red, values.green, values.blue)};
+        });
+        return table;
+    }
+};
+
+} // namespace Core
+} // namespace Ecosystem
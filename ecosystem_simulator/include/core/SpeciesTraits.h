@@ -0,0 +1,161 @@
+#pragma once
+#include "EntityStore.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏷 ÉTIQUETTES D'ESPÈCES (types vides, seulement pour choisir une spécialisation)
+struct Herbivore {};
+struct Carnivore {};
+struct Plant {};
+
+// 🧬 VALEURS PAR DÉFAUT D'UNE ESPÈCE (copiées dans SpeciesTable::Defaults, réglables ensuite)
+struct SpeciesDefaults {
+    float initialEnergy;
+    float maxEnergy;
+    float maxAge;
+    float size;
+    float energyDrainPerSecond;
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+};
+
+// 🧠 TRAITS D'UNE ESPÈCE, CONNUS À LA COMPILATION
+// Ce qui ne change jamais d'une simulation à l'autre : rang dans EntityType,
+// noms, mobilité, chaîne alimentaire (une proie meurt quand son énergie est
+// entièrement mangée). Les boucles spécialisées par espèce
+// (Entity::SeekFood<Species>, Ecosystem::HandleBehaviors...) les lisent avec
+// if constexpr : aucun test de type ne reste dans le code généré.
+// Les réglages numériques (énergie, âge, dépense...) restent dans SpeciesTable.
+//
+// Ajouter une espèce : une valeur dans EntityType, une spécialisation ici et
+// son étiquette dans AllSpecies.
+template <typename Species>
+struct SpeciesTraits;
+
+template <>
+struct SpeciesTraits<Herbivore> {
+    static constexpr EntityType Type = EntityType::HERBIVORE;
+    static constexpr const char* Name = "Herbivore";        // Noms d'entités (EntityName)
+    static constexpr const char* Key = "herbivore";         // Clés des balayages (EnsembleRunner)
+
+    // COMPORTEMENT
+    static constexpr bool IsMobile = true;
+    static constexpr float MaxSpeed = 4.0f;                 // Unité de Move (×20 px/s)
+    static constexpr bool HasPrey = true;
+    static constexpr EntityType Prey = EntityType::PLANT;
+    static constexpr float BiteEnergy = 2.0f;               // Broutage : énergie prélevée par tick de contact
+    static constexpr bool EatsGroundFood = true;            // Nourriture au sol (FoodStore)
+    static constexpr bool HasPredator = true;               // Fuit ses prédateurs
+    static constexpr EntityType Predator = EntityType::CARNIVORE;
+    static constexpr float EnergyPerTick = 0.0f;            // Gain fixe à chaque repas (photosynthèse)
+
+    static constexpr SpeciesDefaults Defaults = {80.0f, 150.0f, 200.0f, 8.0f, 1.5f, 0, 0, 255};
+};
+
+template <>
+struct SpeciesTraits<Carnivore> {
+    static constexpr EntityType Type = EntityType::CARNIVORE;
+    static constexpr const char* Name = "Carnivore";
+    static constexpr const char* Key = "carnivore";
+
+    // COMPORTEMENT
+    static constexpr bool IsMobile = true;
+    static constexpr float MaxSpeed = 6.0f;
+    static constexpr bool HasPrey = true;
+    static constexpr EntityType Prey = EntityType::HERBIVORE;
+    static constexpr float BiteEnergy = std::numeric_limits<float>::infinity();     // Proie avalée entière
+    static constexpr bool EatsGroundFood = false;
+    static constexpr bool HasPredator = false;
+    static constexpr EntityType Predator = EntityType::CARNIVORE;
+    static constexpr float EnergyPerTick = 0.0f;
+
+    static constexpr SpeciesDefaults Defaults = {100.0f, 200.0f, 150.0f, 12.0f, 2.0f, 255, 0, 0};
+};
+
+template <>
+struct SpeciesTraits<Plant> {
+    static constexpr EntityType Type = EntityType::PLANT;
+    static constexpr const char* Name = "Plant";
+    static constexpr const char* Key = "plant";
+
+    // COMPORTEMENT : immobile, produit sa propre énergie
+    static constexpr bool IsMobile = false;
+    static constexpr float MaxSpeed = 0.0f;
+    static constexpr bool HasPrey = false;
+    static constexpr EntityType Prey = EntityType::PLANT;
+    static constexpr float BiteEnergy = 0.0f;
+    static constexpr bool EatsGroundFood = false;
+    static constexpr bool HasPredator = false;
+    static constexpr EntityType Predator = EntityType::PLANT;
+    static constexpr float EnergyPerTick = 0.1f;
+
+    static constexpr SpeciesDefaults Defaults = {50.0f, 100.0f, 300.0f, 6.0f, -0.5f, 0, 255, 0};
+};
+
+// 📋 LISTE DES ESPÈCES, dans l'ordre de EntityType
+template <typename... Species>
+struct SpeciesList {
+    static constexpr size_t Count = sizeof...(Species);
+
+    // Appelle function(Species{}) pour chaque espèce, dans l'ordre de la liste
+    template <typename Function>
+    static void ForEach(Function&& function) { (function(Species{}), ...); }
+
+    // Table indexée par EntityType : table[Type] = function(Species{})
+    template <typename Value, typename Function>
+    static constexpr std::array<Value, Count> MakeTable(Function function) {
+        return {{static_cast<Value>(function(Species{}))...}};
+    }
+
+    // Tous les noms tiennent en maxLength caractères (tampon de EntityName)
+    static constexpr bool NamesFit(size_t maxLength) {
+        bool fit = true;
+        ((fit = fit && Length(SpeciesTraits<Species>::Name) <= maxLength), ...);
+        return fit;
+    }
+
+    static constexpr bool IsOrderedLikeEntityType() {
+        size_t index = 0;
+        bool ordered = true;
+        ((ordered = ordered && static_cast<size_t>(SpeciesTraits<Species>::Type) == index++), ...);
+        return ordered;
+    }
+
+private:
+    static constexpr size_t Length(const char* text) {
+        size_t length = 0;
+        while (text[length] != '\0') ++length;
+        return length;
+    }
+};
+
+using AllSpecies = SpeciesList<Herbivore, Carnivore, Plant>;
+
+static_assert(AllSpecies::Count == SpeciesCount, "AllSpecies doit lister chaque valeur de EntityType");
+static_assert(AllSpecies::IsOrderedLikeEntityType(), "AllSpecies doit suivre l'ordre de EntityType");
+static_assert(AllSpecies::NamesFit(EntityName::MaxTypeNameLength), "Nom d'espèce trop long pour EntityName");
+
+// 🔁 RACCOURCIS
+// Usage : ForEachSpecies([&](auto species) { using Species = decltype(species); ... });
+template <typename Function>
+void ForEachSpecies(Function&& function) { AllSpecies::ForEach(function); }
+
+template <typename Value, typename Function>
+constexpr std::array<Value, SpeciesCount> MakeSpeciesTable(Function function) {
+    return AllSpecies::MakeTable<Value>(function);
+}
+
+// Noms et clés, indexés par EntityType
+inline constexpr std::array<const char*, SpeciesCount> SpeciesNames =
+    MakeSpeciesTable<const char*>([](auto species) { return SpeciesTraits<decltype(species)>::Name; });
+inline constexpr std::array<const char*, SpeciesCount> SpeciesKeys =
+    MakeSpeciesTable<const char*>([](auto species) { return SpeciesTraits<decltype(species)>::Key; });
+
+} // namespace Core
+} // namespace Ecosystem
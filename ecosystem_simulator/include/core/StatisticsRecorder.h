@@ -0,0 +1,142 @@
+#pragma once
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 📈 FORMAT DU FICHIER DE SÉRIES TEMPORELLES
+// [StatisticsFileHeader][ColumnCount x StatisticsColumnInfo] puis des blocs :
+//   [StatisticsChunkHeader][colonne 0 : rowCount valeurs][colonne 1]...
+// Une ligne par tick, ticks consécutifs dans un bloc (tick = firstTick + ligne).
+// Toutes les valeurs font 4 octets (entier ou flottant, ordre des octets de la
+// machine). Un arrêt brutal ne perd que le bloc en cours d'écriture.
+struct StatisticsFileHeader {
+    static constexpr char Magic[8] = {'E', 'C', 'O', 'S', 'T', 'A', 'T', 'S'};
+    static constexpr uint32_t Version = 1;
+    static constexpr uint32_t ByteOrderMark = 0x01020304u;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t columnCount;
+    uint32_t chunkCapacity;         // Lignes maximales par bloc
+};
+
+// TYPES DE COLONNES
+enum class StatisticsColumnType : uint32_t {
+    Int32,
+    Float32
+};
+
+struct StatisticsColumnInfo {
+    char name[24];                  // Nom de colonne CSV, terminé par '\0'
+    StatisticsColumnType type;
+    uint32_t reserved;
+};
+
+struct StatisticsChunkHeader {
+    uint32_t rowCount;
+    uint32_t reserved;
+    uint64_t firstTick;
+};
+
+// 📊 UNE LIGNE : un tick de simulation
+// Les moyennes par espèce sont indexées par EntityType (0 si l'espèce est éteinte).
+struct StatisticsSample {
+    int32_t herbivores;
+    int32_t carnivores;
+    int32_t plants;
+    int32_t food;
+    int32_t birthsToday;
+    int32_t deathsToday;
+    int32_t entities;               // Cases occupées (vivantes)
+    std::array<float, 3> averageEnergy;
+    std::array<float, 3> averageAge;
+};
+
+// 📼 ENREGISTREUR DE STATISTIQUES EN CONTINU
+// Record() copie la ligne dans le bloc courant (quelques écritures, ni
+// allocation ni appel système). Un bloc plein part vers un thread d'écriture
+// qui l'écrit en colonnes, et en CSV si demandé ; le tick suivant continue
+// dans un bloc libre de la réserve. Si le disque ne suit pas, Record() attend
+// un bloc libre : aucune ligne n'est perdue, l'attente est comptée.
+class StatisticsRecorder {
+public:
+    static constexpr size_t ColumnCount = 13;
+    static constexpr uint32_t ChunkCapacity = 4096;     // ~68 s à 60 ticks/s, 208 Ko
+    static constexpr size_t ChunkPoolSize = 4;
+
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    StatisticsRecorder();
+    ~StatisticsRecorder();          // Équivaut à Close()
+
+    StatisticsRecorder(const StatisticsRecorder&) = delete;
+    StatisticsRecorder& operator=(const StatisticsRecorder&) = delete;
+
+    // ⚙ CYCLE DE VIE
+    // Chemin vide = format non écrit (au moins l'un des deux)
+    bool Open(const std::string& path, const std::string& csvPath = std::string());
+    void Close();                   // Écrit le bloc partiel et attend le thread d'écriture
+    bool IsOpen() const { return mOpen; }
+
+    // 📥 UN TICK (thread de simulation uniquement)
+    // Un tick non consécutif (monde réinitialisé ou rechargé) ouvre un nouveau bloc
+    void Record(uint64_t tick, const StatisticsSample& sample);
+
+    // 🔄 CONVERSION D'UN FICHIER EXISTANT EN CSV
+    static bool ExportCsv(const std::string& path, const std::string& csvPath, std::string& error);
+
+    // GETTERS
+    uint64_t GetRecordedTicks() const { return mRecordedTicks; }
+    uint64_t GetStallCount() const { return mStalls; }
+    static const StatisticsColumnInfo& GetColumn(size_t column);
+
+private:
+    // BLOC : valeurs rangées colonne par colonne, values[colonne * ChunkCapacity + ligne]
+    struct Chunk {
+        uint64_t firstTick;
+        uint32_t rowCount;
+        std::unique_ptr<uint32_t[]> values;
+    };
+
+    // DONNÉES INTERNES
+    bool mOpen;
+    FILE* mFile;
+    FILE* mCsv;
+    std::array<Chunk, ChunkPoolSize> mChunks;
+    Chunk* mCurrent;                        // Bloc rempli par Record()
+    uint64_t mNextTick;
+    uint64_t mRecordedTicks;
+    uint64_t mStalls;
+    bool mWriteFailed;                      // Écrit par le thread d'écriture, lu après join
+
+    // ÉCHANGE AVEC LE THREAD D'ÉCRITURE (capacité réservée : aucune allocation)
+    std::mutex mMutex;
+    std::condition_variable mReadyCondition;
+    std::condition_variable mFreeCondition;
+    std::vector<Chunk*> mReady;             // Blocs pleins, dans l'ordre des ticks
+    std::vector<Chunk*> mFree;
+    bool mStopping;
+    std::thread mWriter;
+
+    // MÉTHODES PRIVÉES
+    void Submit();                          // Envoie mCurrent et en prend un libre
+    void WriterLoop();
+    bool WriteChunk(const Chunk& chunk);
+    // CSV commun à l'enregistrement et à la conversion : colonne c, ligne r = values[c * columnStride + r]
+    static void WriteCsvHeader(FILE* csv, const StatisticsColumnInfo* columns, size_t columnCount);
+    static void WriteCsvRows(FILE* csv, const StatisticsColumnInfo* columns, size_t columnCount,
+                             uint64_t firstTick, uint32_t rowCount, const uint32_t* values, size_t columnStride);
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -25,10 +25,33 @@ struct Vector2D {
         return Vector2D(x + other.x, y + other.y); 
     }
 
+    Vector2D operator-(const Vector2D& other) const { 
+        return Vector2D(x - other.x, y - other.y); 
+    }
+
+    Vector2D operator-() const { 
+        return Vector2D(-x, -y); 
+    }
+
     Vector2D operator*(float scalar) const { 
         return Vector2D(x * scalar, y * scalar); 
     }
 
+    float LengthSquared() const { 
+        return x * x + y * y; 
+    }
+
+    float Length() const { 
+        return std::sqrt(LengthSquared()); 
+    }
+
+    // Vecteur unitaire (nul si la longueur est nulle) 
+    Vector2D Normalized() const { 
+        float length = Length(); 
+        if (length <= 0.0f) return Vector2D(0.0f, 0.0f); 
+        return Vector2D(x / length, y / length); 
+    }
+
  }; 
 
 struct Color { 
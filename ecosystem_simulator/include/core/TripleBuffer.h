@@ -0,0 +1,62 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🔁 TRIPLE TAMPON SANS VERROU (un producteur, un consommateur)
+// Trois exemplaires de T : le producteur remplit le sien, le consommateur lit
+// le sien, le troisième attend au milieu. Publier échange le tampon du
+// producteur avec celui du milieu, acquérir échange le milieu avec celui du
+// consommateur : chaque échange est un seul exchange atomique, personne
+// n'attend personne. Un producteur plus rapide écrase une image jamais lue
+// (image perdue, comptée ici) ; un consommateur plus rapide relit la sienne.
+// Les tampons sont réutilisés : leur capacité est conservée d'une image à l'autre.
+template <typename T>
+class TripleBuffer {
+private:
+    static constexpr uint8_t IndexMask = 0x3;
+    static constexpr uint8_t FreshBit = 0x4;   // Le tampon du milieu n'a pas encore été lu
+
+    // 🔒 ÉTAT
+    std::array<T, 3> mBuffers;
+    alignas(64) std::atomic<uint8_t> mMiddle;   // Indice du milieu | FreshBit
+    alignas(64) uint8_t mWriteIndex;            // Producteur seulement
+    alignas(64) uint8_t mReadIndex;             // Consommateur seulement
+    std::atomic<uint64_t> mDroppedFrames;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    TripleBuffer() : mMiddle(1), mWriteIndex(0), mReadIndex(2), mDroppedFrames(0) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // ✍ PRODUCTEUR : remplir GetWriteBuffer(), puis Publish()
+    T& GetWriteBuffer() { return mBuffers[mWriteIndex]; }
+    void Publish() {
+        const uint8_t previous = mMiddle.exchange(mWriteIndex | FreshBit, std::memory_order_acq_rel);
+        mWriteIndex = previous & IndexMask;
+        if (previous & FreshBit) {
+            mDroppedFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // 👁 CONSOMMATEUR : true si une image plus récente a été prise
+    // (sinon GetReadBuffer() est l'image précédente)
+    bool Acquire() {
+        if ((mMiddle.load(std::memory_order_relaxed) & FreshBit) == 0) return false;
+        const uint8_t previous = mMiddle.exchange(mReadIndex, std::memory_order_acq_rel);
+        mReadIndex = previous & IndexMask;
+        return true;
+    }
+    const T& GetReadBuffer() const { return mBuffers[mReadIndex]; }
+
+    // GETTERS (depuis n'importe quel thread)
+    uint64_t GetDroppedFrames() const { return mDroppedFrames.load(std::memory_order_relaxed); }
+};
+
+} // namespace Core
+} // namespace Ecosystem
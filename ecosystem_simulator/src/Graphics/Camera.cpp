@@ -0,0 +1,67 @@
+#include "Graphics/Camera.h"
+#include <algorithm>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🏗 CONSTRUCTEUR
+Camera::Camera(float viewportWidth, float viewportHeight)
+    : mCenter(viewportWidth / 2.0f, viewportHeight / 2.0f), mZoom(1.0f),
+      mViewportWidth(viewportWidth), mViewportHeight(viewportHeight) {}
+
+// 📐 TAILLE DE LA FENÊTRE
+void Camera::SetViewport(float width, float height) {
+    mViewportWidth = width;
+    mViewportHeight = height;
+}
+
+// 🎯 CENTRAGE
+void Camera::CenterOn(Core::Vector2D worldPosition) {
+    mCenter = worldPosition;
+}
+
+// 🌍 VUE D'ENSEMBLE : le monde entier tient dans la fenêtre
+void Camera::FitWorld(float worldWidth, float worldHeight) {
+    mCenter = Core::Vector2D(worldWidth / 2.0f, worldHeight / 2.0f);
+    if (worldWidth > 0.0f && worldHeight > 0.0f) {
+        float zoom = std::min(mViewportWidth / worldWidth, mViewportHeight / worldHeight);
+        mZoom = std::clamp(zoom, MinZoom, MaxZoom);
+    }
+}
+
+// ✋ DÉPLACEMENT (en pixels d'écran)
+void Camera::Pan(float screenDeltaX, float screenDeltaY) {
+    mCenter.x -= screenDeltaX / mZoom;
+    mCenter.y -= screenDeltaY / mZoom;
+}
+
+// 🔍 ZOOM AUTOUR D'UN POINT DE L'ÉCRAN
+void Camera::ZoomAt(float factor, Core::Vector2D screenPoint) {
+    Core::Vector2D anchor = ScreenToWorld(screenPoint);
+    mZoom = std::clamp(mZoom * factor, MinZoom, MaxZoom);
+    // Recentrage pour que anchor reste sous screenPoint
+    mCenter.x = anchor.x - (screenPoint.x - mViewportWidth / 2.0f) / mZoom;
+    mCenter.y = anchor.y - (screenPoint.y - mViewportHeight / 2.0f) / mZoom;
+}
+
+// 🔁 MONDE → ÉCRAN
+Core::Vector2D Camera::WorldToScreen(Core::Vector2D worldPosition) const {
+    return Core::Vector2D((worldPosition.x - mCenter.x) * mZoom + mViewportWidth / 2.0f,
+                          (worldPosition.y - mCenter.y) * mZoom + mViewportHeight / 2.0f);
+}
+
+// 🔁 ÉCRAN → MONDE
+Core::Vector2D Camera::ScreenToWorld(Core::Vector2D screenPosition) const {
+    return Core::Vector2D((screenPosition.x - mViewportWidth / 2.0f) / mZoom + mCenter.x,
+                          (screenPosition.y - mViewportHeight / 2.0f) / mZoom + mCenter.y);
+}
+
+// 🔲 ZONE VISIBLE (agrandie de margin unités du monde)
+Camera::Rect Camera::GetVisibleRect(float margin) const {
+    const float halfWidth = mViewportWidth / (2.0f * mZoom) + margin;
+    const float halfHeight = mViewportHeight / (2.0f * mZoom) + margin;
+    return {mCenter.x - halfWidth, mCenter.y - halfHeight, mCenter.x + halfWidth, mCenter.y + halfHeight};
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,177 @@
+#include "Graphics/Renderer.h"
+#include <cstdio>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// Marge de culling (unités du monde) : plus grande entité et barre d'énergie,
+// plus le déplacement interpolé depuis le début du tick
+static constexpr float CullingMargin = 24.0f;
+
+// 🏗 CONSTRUCTEUR
+Renderer::Renderer()
+    : mRenderer(nullptr), mCamera(nullptr), mLastQuadCount(0), mLastDrawCalls(0), mLastVisibleEntities(0) {}
+
+// ⚙️ INITIALISATION
+void Renderer::Initialize(SDL_Renderer* renderer, const std::string& textureDirectory) {
+    mRenderer = renderer;
+    mAtlas.Build(renderer, textureDirectory);
+}
+
+// 🌍 RENDU COMPLET : un lot par image, limité à la zone visible
+void Renderer::DrawEcosystem(const Core::RenderFrame& frame, const Camera& camera, float alpha) {
+    if (!mRenderer) return;
+    mCamera = &camera;
+    const Camera::Rect visible = camera.GetVisibleRect(CullingMargin);
+
+    BeginBatch();
+    DrawWorldBounds(frame);
+    DrawFood(frame, visible);
+    DrawEntities(frame, visible, alpha);
+    FlushBatch();
+    mCamera = nullptr;
+}
+
+// ⏱ SUPERPOSITION DU PROFILEUR (police de débogage SDL : 8 px, ASCII)
+void Renderer::DrawProfilerOverlay(const Core::RenderFrame& frame, float x, float y) {
+    if (!mRenderer) return;
+    constexpr float LineHeight = 10.0f;
+    constexpr float Padding = 6.0f;
+    constexpr int Columns = 44;
+    const int lineCount = Core::Profiler::Enabled ? static_cast<int>(Core::Profiler::PhaseCount) + 1 : 1;
+
+    const SDL_FRect background = {x, y, Columns * 8.0f + 2.0f * Padding, lineCount * LineHeight + 2.0f * Padding};
+    SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 255);
+    SDL_RenderFillRect(mRenderer, &background);
+
+    SDL_SetRenderDrawColor(mRenderer, 230, 230, 230, 255);
+    float lineY = y + Padding;
+    if (!Core::Profiler::Enabled) {
+        SDL_RenderDebugText(mRenderer, x + Padding, lineY, "profilage desactive (ECOSYSTEM_PROFILE=0)");
+        return;
+    }
+    if (!frame.hasProfile) {
+        SDL_RenderDebugText(mRenderer, x + Padding, lineY, "en attente de la simulation...");
+        return;
+    }
+
+    char line[64];
+    std::snprintf(line, sizeof(line), "%-16s %8s %8s %8s", "phase (ms)", "min", "moy", "p99");
+    SDL_RenderDebugText(mRenderer, x + Padding, lineY, line);
+    for (size_t i = 0; i < Core::Profiler::PhaseCount; ++i) {
+        const Core::ProfilePhase phase = static_cast<Core::ProfilePhase>(i);
+        const Core::Profiler::Summary& summary = frame.profile[i];
+        lineY += LineHeight;
+        std::snprintf(line, sizeof(line), "%-16s %8.3f %8.3f %8.3f", Core::Profiler::GetName(phase),
+                      summary.minimumMs, summary.averageMs, summary.p99Ms);
+        SDL_RenderDebugText(mRenderer, x + Padding, lineY, line);
+    }
+}
+
+// 🔲 BORDS DU MONDE (un pixel d'épaisseur à tous les niveaux de zoom)
+void Renderer::DrawWorldBounds(const Core::RenderFrame& frame) {
+    const Core::Color borderColor(90, 90, 90);
+    Core::Vector2D topLeft = mCamera->WorldToScreen(Core::Vector2D(0.0f, 0.0f));
+    Core::Vector2D bottomRight = mCamera->WorldToScreen(
+        Core::Vector2D(frame.worldWidth, frame.worldHeight));
+    const float width = bottomRight.x - topLeft.x;
+    const float height = bottomRight.y - topLeft.y;
+    PushScreenQuad(topLeft.x, topLeft.y, width, 1.0f, borderColor);
+    PushScreenQuad(topLeft.x, bottomRight.y - 1.0f, width, 1.0f, borderColor);
+    PushScreenQuad(topLeft.x, topLeft.y, 1.0f, height, borderColor);
+    PushScreenQuad(bottomRight.x - 1.0f, topLeft.y, 1.0f, height, borderColor);
+}
+
+// 🍎 RENDU DE LA NOURRITURE VISIBLE
+void Renderer::DrawFood(const Core::RenderFrame& frame, const Camera::Rect& visible) {
+    for (const Core::Food& food : frame.food) {
+        const Core::Vector2D& position = food.position;
+        if (position.x < visible.minX || position.x > visible.maxX || position.y < visible.minY || position.y > visible.maxY) continue;
+        PushQuad(position.x - 3.0f, position.y - 3.0f, 6.0f, 6.0f, food.color);
+    }
+}
+
+// 🐾 RENDU DES ENTITÉS VISIBLES (l'image ne copie que les vivantes de la zone de la caméra)
+void Renderer::DrawEntities(const Core::RenderFrame& frame, const Camera::Rect& visible, float alpha) {
+    int visibleCount = 0;
+    const size_t count = frame.GetEntityCount();
+    for (size_t i = 0; i < count; ++i) {
+        const float x = frame.positionX[i];
+        const float y = frame.positionY[i];
+        if (x < visible.minX || x > visible.maxX || y < visible.minY || y > visible.maxY) continue;
+        DrawEntity(frame, i, alpha);
+        ++visibleCount;
+    }
+    mLastVisibleEntities = visibleCount;
+}
+
+// 🐾 UNE ENTITÉ ET SA BARRE D'ÉNERGIE
+void Renderer::DrawEntity(const Core::RenderFrame& frame, size_t i, float alpha) {
+    Core::Color renderColor = Core::Entity::CalculateColorBasedOnState(frame.color[i], frame.energyRatio[i]);
+    float size = frame.size[i];
+
+    // Interpolation entre les deux derniers ticks : mouvement fluide à pas fixe
+    float x = frame.previousPositionX[i] + (frame.positionX[i] - frame.previousPositionX[i]) * alpha;
+    float y = frame.previousPositionY[i] + (frame.positionY[i] - frame.previousPositionY[i]) * alpha;
+
+    PushQuad(x - size / 2.0f, y - size / 2.0f, size, size, renderColor, mAtlas.GetSpecies(frame.type[i]));
+
+    // Indicateur d'énergie (barre de vie)
+    if (frame.type[i] != Core::EntityType::PLANT) {
+        float energyBarWidth = size * frame.energyRatio[i];
+        PushQuad(x - size / 2.0f, y - size / 2.0f - 3.0f, energyBarWidth, 2.0f, Core::Color(0, 255, 0));
+    }
+}
+
+// 📦 DÉBUT DU LOT : la capacité des tampons est conservée
+void Renderer::BeginBatch() {
+    mVertices.clear();
+}
+
+// ➕ AJOUT D'UN QUAD DU MONDE (converti en pixels par la caméra)
+void Renderer::PushQuad(float x, float y, float width, float height, Core::Color color) {
+    PushQuad(x, y, width, height, color, mAtlas.GetSolid());
+}
+
+void Renderer::PushQuad(float x, float y, float width, float height, Core::Color color,
+                        const SpriteAtlas::Region& region) {
+    const Core::Vector2D screen = mCamera->WorldToScreen(Core::Vector2D(x, y));
+    const float zoom = mCamera->GetZoom();
+    PushScreenQuad(screen.x, screen.y, width * zoom, height * zoom, color, region);
+}
+
+// ➕ AJOUT D'UN QUAD EN PIXELS (couleur portée par les sommets : aucun changement d'état)
+void Renderer::PushScreenQuad(float x, float y, float width, float height, Core::Color color) {
+    PushScreenQuad(x, y, width, height, color, mAtlas.GetSolid());
+}
+
+void Renderer::PushScreenQuad(float x, float y, float width, float height, Core::Color color,
+                              const SpriteAtlas::Region& region) {
+    const SDL_FColor vertexColor = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    mVertices.push_back({{x, y}, vertexColor, {region.u0, region.v0}});
+    mVertices.push_back({{x + width, y}, vertexColor, {region.u1, region.v0}});
+    mVertices.push_back({{x + width, y + height}, vertexColor, {region.u1, region.v1}});
+    mVertices.push_back({{x, y + height}, vertexColor, {region.u0, region.v1}});
+}
+
+// 🚀 ENVOI DU LOT EN UN SEUL APPEL
+void Renderer::FlushBatch() {
+    const int quadCount = static_cast<int>(mVertices.size() / 4);
+    mLastQuadCount = quadCount;
+    mLastDrawCalls = 0;
+    if (quadCount == 0) return;
+
+    // Motif d'indices (deux triangles par quad), étendu seulement si la population grandit
+    for (int quad = static_cast<int>(mIndices.size() / 6); quad < quadCount; ++quad) {
+        const int first = quad * 4;
+        mIndices.insert(mIndices.end(), {first, first + 1, first + 2, first + 2, first + 3, first});
+    }
+
+    // Texture de l'atlas pour tout le lot (nullptr si l'atlas a échoué : quads unis)
+    SDL_RenderGeometry(mRenderer, mAtlas.GetTexture(), mVertices.data(), static_cast<int>(mVertices.size()),
+                       mIndices.data(), quadCount * 6);
+    mLastDrawCalls = 1;
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
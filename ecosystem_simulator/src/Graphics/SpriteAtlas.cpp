@@ -0,0 +1,195 @@
+#include "Graphics/SpriteAtlas.h"
+#include "Core/Logger.h"
+#include "Core/SpeciesTraits.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// Pixels transparents autour de chaque sprite (le filtrage ne déborde pas sur le voisin)
+static constexpr int Padding = 2;
+static constexpr int SolidSize = 4;
+
+// 🏗 CONSTRUCTEUR/DESTRUCTEUR
+SpriteAtlas::SpriteAtlas()
+    : mTexture(nullptr), mSpecies{}, mSolid{}, mWidth(0), mHeight(0), mLoadedSprites(0) {}
+
+SpriteAtlas::~SpriteAtlas() {
+    Release();
+}
+
+// ⚙ CONSTRUCTION DE L'ATLAS
+bool SpriteAtlas::Build(SDL_Renderer* renderer, const std::string& directory) {
+    Release();
+    if (!renderer) return false;
+
+    // 1. Images : le carré blanc, puis une par espèce (fichier, sinon forme procédurale)
+    std::vector<Image> images;
+    Image solid;
+    solid.width = SolidSize;
+    solid.height = SolidSize;
+    solid.pixels.assign(SolidSize * SolidSize * 4, 255);
+    images.push_back(std::move(solid));
+
+    const char* basePath = SDL_GetBasePath();       // Dossier de l'exécutable (lancé d'ailleurs)
+    Core::ForEachSpecies([&](auto species) {
+        using Traits = Core::SpeciesTraits<decltype(species)>;
+        const std::string file = directory + "/" + Traits::Key + ".bmp";
+        Image image = LoadBitmap(file);
+        if (image.pixels.empty() && basePath) {
+            image = LoadBitmap(std::string(basePath) + file);
+        }
+        if (image.pixels.empty()) {
+            image = MakeProceduralSprite(Traits::Type);
+        } else {
+            ++mLoadedSprites;
+        }
+        images.push_back(std::move(image));
+    });
+
+    // 2. Rangement en étagères, dans l'ordre : carré blanc puis espèces selon EntityType
+    std::vector<std::pair<int, int>> origins(images.size());
+    int x = Padding;
+    int y = Padding;
+    int shelfHeight = 0;
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (x + images[i].width + Padding > AtlasWidth) {
+            x = Padding;
+            y += shelfHeight + Padding;
+            shelfHeight = 0;
+        }
+        origins[i] = {x, y};
+        x += images[i].width + Padding;
+        shelfHeight = std::max(shelfHeight, images[i].height);
+    }
+    mWidth = AtlasWidth;
+    mHeight = y + shelfHeight + Padding;
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(mWidth) * mHeight * 4, 0);
+    for (size_t i = 0; i < images.size(); ++i) {
+        const Image& image = images[i];
+        for (int row = 0; row < image.height; ++row) {
+            const size_t target = (static_cast<size_t>(origins[i].second + row) * mWidth + origins[i].first) * 4;
+            std::memcpy(&pixels[target], &image.pixels[static_cast<size_t>(row) * image.width * 4], image.width * 4);
+        }
+    }
+
+    // 3. Zones en coordonnées de texture (le carré blanc : son centre, quel que soit le quad)
+    const float inverseWidth = 1.0f / mWidth;
+    const float inverseHeight = 1.0f / mHeight;
+    const float solidU = (origins[0].first + SolidSize * 0.5f) * inverseWidth;
+    const float solidV = (origins[0].second + SolidSize * 0.5f) * inverseHeight;
+    mSolid = {solidU, solidV, solidU, solidV};
+    for (size_t type = 0; type < Core::SpeciesCount; ++type) {
+        const auto& origin = origins[1 + type];
+        const Image& image = images[1 + type];
+        mSpecies[type] = {origin.first * inverseWidth, origin.second * inverseHeight,
+                          (origin.first + image.width) * inverseWidth, (origin.second + image.height) * inverseHeight};
+    }
+
+    // 4. Texture unique
+    mTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, mWidth, mHeight);
+    if (!mTexture) {
+        ECO_LOG_WARNING("⚠ Atlas de sprites impossible (" << SDL_GetError() << ") : rendu en quads unis");
+        return false;
+    }
+    SDL_UpdateTexture(mTexture, nullptr, pixels.data(), mWidth * 4);
+    SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
+
+    ECO_LOG_INFO("🖼 Atlas de sprites " << mWidth << "x" << mHeight << " : " << mLoadedSprites
+              << " sprite(s) lu(s) dans " << directory << ", "
+              << (Core::SpeciesCount - static_cast<size_t>(mLoadedSprites)) << " procédural(aux)");
+    return true;
+}
+
+// 🧹 LIBÉRATION (avant la destruction du renderer SDL)
+void SpriteAtlas::Release() {
+    if (mTexture) {
+        SDL_DestroyTexture(mTexture);
+        mTexture = nullptr;
+    }
+    mLoadedSprites = 0;
+}
+
+// 📂 LECTURE D'UN BMP (SDL seul, sans dépendance d'images), converti en RGBA
+SpriteAtlas::Image SpriteAtlas::LoadBitmap(const std::string& path) {
+    Image image;
+    SDL_Surface* loaded = SDL_LoadBMP(path.c_str());
+    if (!loaded) return image;
+    SDL_Surface* rgba = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+    SDL_DestroySurface(loaded);
+    if (!rgba) return image;
+
+    if (rgba->w > 0 && rgba->h > 0 && rgba->w <= MaxSpriteSize && rgba->h <= MaxSpriteSize) {
+        image.width = rgba->w;
+        image.height = rgba->h;
+        image.pixels.resize(static_cast<size_t>(image.width) * image.height * 4);
+        const uint8_t* source = static_cast<const uint8_t*>(rgba->pixels);
+        for (int row = 0; row < image.height; ++row) {
+            std::memcpy(&image.pixels[static_cast<size_t>(row) * image.width * 4],
+                        source + static_cast<size_t>(row) * rgba->pitch, image.width * 4);
+        }
+    } else {
+        ECO_LOG_WARNING("⚠ Sprite ignoré (taille " << rgba->w << "x" << rgba->h << ", max "
+                        << MaxSpriteSize << ") : " << path);
+    }
+    SDL_DestroySurface(rgba);
+    return image;
+}
+
+// 🎨 SPRITE PROCÉDURAL : forme blanche ombrée, bords adoucis (4x4 échantillons par pixel)
+// Herbivore : disque ; carnivore : losange ; plante : trèfle ; autre espèce : carré
+SpriteAtlas::Image SpriteAtlas::MakeProceduralSprite(Core::EntityType type) {
+    auto inside = [type](float x, float y) {       // x, y dans [-1, 1]
+        switch (type) {
+            case Core::EntityType::HERBIVORE:
+                return x * x + y * y <= 0.85f;
+            case Core::EntityType::CARNIVORE:
+                return std::fabs(x) + std::fabs(y) <= 0.95f;
+            case Core::EntityType::PLANT: {
+                const float lobe = 0.5f;
+                const float radiusSquared = 0.2f;
+                return (x - lobe) * (x - lobe) + y * y <= radiusSquared || (x + lobe) * (x + lobe) + y * y <= radiusSquared ||
+                       x * x + (y - lobe) * (y - lobe) <= radiusSquared || x * x + (y + lobe) * (y + lobe) <= radiusSquared;
+            }
+            default:
+                return std::fabs(x) <= 0.85f && std::fabs(y) <= 0.85f;
+        }
+    };
+
+    constexpr int Size = ProceduralSpriteSize;
+    constexpr int Samples = 4;
+    Image image;
+    image.width = Size;
+    image.height = Size;
+    image.pixels.resize(Size * Size * 4);
+    for (int py = 0; py < Size; ++py) {
+        for (int px = 0; px < Size; ++px) {
+            int covered = 0;
+            for (int sy = 0; sy < Samples; ++sy) {
+                for (int sx = 0; sx < Samples; ++sx) {
+                    const float x = ((px + (sx + 0.5f) / Samples) / Size) * 2.0f - 1.0f;
+                    const float y = ((py + (sy + 0.5f) / Samples) / Size) * 2.0f - 1.0f;
+                    covered += inside(x, y);
+                }
+            }
+            // Éclairage venu du haut à gauche : la teinte des sommets garde la couleur de l'espèce
+            const float cx = ((px + 0.5f) / Size) * 2.0f - 1.0f;
+            const float cy = ((py + 0.5f) / Size) * 2.0f - 1.0f;
+            const float light = std::clamp(1.0f - 0.25f * ((cx + 0.4f) * (cx + 0.4f) + (cy + 0.4f) * (cy + 0.4f)), 0.55f, 1.0f);
+            const uint8_t shade = static_cast<uint8_t>(255.0f * light);
+            uint8_t* pixel = &image.pixels[(static_cast<size_t>(py) * Size + px) * 4];
+            pixel[0] = shade;
+            pixel[1] = shade;
+            pixel[2] = shade;
+            pixel[3] = static_cast<uint8_t>(255 * covered / (Samples * Samples));
+        }
+    }
+    return image;
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -16,7 +16,7 @@ Window::~Window() {
 
 // ⚙️ INITIALISATION
 bool Window::Initialize() {
-    if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+    if (!SDL_Init(SDL_INIT_VIDEO)) {    // SDL3 : true en cas de succès
         std::cerr << "❌ Erreur SDL_Init: " << SDL_GetError() << std::endl;
         return false;
     }
@@ -74,5 +74,12 @@ void Window::Present() {
     }
 }
 
+// 🏷 TITRE DE LA FENÊTRE (le titre d'origine est conservé pour les préfixes)
+void Window::SetTitle(const std::string& title) {
+    if (mWindow) {
+        SDL_SetWindowTitle(mWindow, title.c_str());
+    }
+}
+
 } // namespace Graphics
 } // namespace Ecosystem
\ No newline at end of file
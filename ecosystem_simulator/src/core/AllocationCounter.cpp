@@ -0,0 +1,61 @@
+#include "Core/AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> gAllocations{0};
+std::atomic<uint64_t> gDeallocations{0};
+std::atomic<uint64_t> gBytes{0};
+
+} // namespace
+
+namespace Ecosystem {
+namespace Core {
+
+// 📖 LECTURE DES COMPTEURS
+AllocationCounter::Snapshot AllocationCounter::Read() {
+    return {gAllocations.load(std::memory_order_relaxed),
+            gDeallocations.load(std::memory_order_relaxed),
+            gBytes.load(std::memory_order_relaxed)};
+}
+
+} // namespace Core
+} // namespace Ecosystem
+
+#ifdef ECOSYSTEM_TRACK_ALLOCATIONS
+
+// 🔁 OPÉRATEURS GLOBAUX DE REMPLACEMENT (toutes les formes non alignées y aboutissent)
+void* operator new(std::size_t size) {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    if (!memory) return;
+    gDeallocations.fetch_add(1, std::memory_order_relaxed);
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
+
+#endif
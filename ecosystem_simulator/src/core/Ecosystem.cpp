@@ -1,30 +1,51 @@
 #include "Core/Ecosystem.h" 
 #include <algorithm> 
-#include <iostream> 
+#include <chrono> 
+#include <cmath> 
+#include <cstring> 
+#include <iterator> 
+#include <random> 
+#include <type_traits> 
+#include <utility> 
+#include "Core/Logger.h" 
+#include "Core/Snapshot.h" 
 
 namespace Ecosystem { 
 namespace Core { 
 
 // 🏗 CONSTRUCTEUR 
-Ecosystem::Ecosystem(float width, float height, int maxEntities) 
-    : mWorldWidth(width), mWorldHeight(height), mMaxEntities(maxEntities), 
-      mDayCycle(0), mRandomGenerator(std::random_device{}()) 
+Ecosystem::Ecosystem(float width, float height, int maxEntities, int threadCount) 
+    : mFood(width, height, Entity::PredatorPerceptionRadius), 
+      mSpecies(SpeciesTable::Defaults()), 
+      mWorldWidth(width), mWorldHeight(height), mMaxEntities(maxEntities), 
+      mDayCycle(0), mWorldSeed(0), mWorldDraws(0), 
+      mJobSystem(std::make_unique<JobSystem>(threadCount)), 
+      mDomain{0.0f, 0.0f, width, height, 0}, mDomainFraction(1.0f), 
+      mEntityGrid(width, height, Entity::PredatorPerceptionRadius), mLargestSize{} 
 { 
     // Initialisation des statistiques 
-    mStats = {0, 0, 0, 0, 0, 0}; 
-    std::cout << "🌍Écosystème créé: " << width << "x" << height << std::endl; 
+    ResetStatistics(); 
+    // Graine imprévisible par défaut (une seule lecture d'entropie par monde) ; SetSeed() la fixe 
+    std::random_device entropy; 
+    mWorldSeed = (static_cast<uint64_t>(entropy()) << 32) | entropy(); 
+    ECO_LOG_INFO("🌍Écosystème créé: " << width << "x" << height); 
 } 
 
 // 🗑 DESTRUCTEUR 
 Ecosystem::~Ecosystem() { 
-    std::cout << "🌍Écosystème détruit (" << mEntities.size() << " entités nettoyé)"<< std::endl; 
+    ECO_LOG_INFO("🌍Écosystème détruit (" << mEntities.LiveCount() << " entités nettoyé)"); 
  } 
 
 // INITIALISATION 
 void Ecosystem::Initialize(int initialHerbivores, int initialCarnivores, int initialPlants)
 {
-    mEntities.clear(); 
-    mFoodSources.clear(); 
+    mEntities.Clear(); 
+    mEntities.SetNextId(static_cast<uint64_t>(mDomain.shard) << ShardIdBits); 
+    mEntities.Reserve(mMaxEntities); 
+    mDayCycle = 0; 
+    ResetStatistics(); 
+    mUnindexedEntities.reserve(mMaxEntities); 
+    mFood.Clear(); 
 
     // Création des entités initiales 
     for (int i = 0; i < initialHerbivores; ++i) { 
@@ -36,174 +57,744 @@ void Ecosystem::Initialize(int initialHerbivores, int initialCarnivores, int ini
     for (int i = 0; i < initialPlants; ++i) { 
         SpawnRandomEntity(EntityType::PLANT); 
     }
-    // Nourriture initiale 
-    SpawnFood(20); 
-    std::cout << "🌱Écosystème initialisé avec " << mEntities.size() << " entités"<< std::endl;
+    // Nourriture initiale (au prorata du domaine) 
+    SpawnFood(static_cast<int>(std::lround(20.0f * mDomainFraction))); 
+    RebuildSpatialIndex(); 
+    // Extrêmes du premier jour à partir de la population initiale 
+    mMinimumPopulationToday = mMaximumPopulationToday = static_cast<int>(mEntities.LiveCount()); 
+    mProfiler.Reset();                  // Les fenêtres ne mélangent pas deux populations 
+    ECO_LOG_INFO("🌱Écosystème initialisé avec " << mEntities.LiveCount() << " entités");
  } 
 
+// 💾 SAUVEGARDE D'UN INSTANTANÉ : état complet, la reprise donne le même résultat 
+// que si la simulation ne s'était jamais arrêtée 
+bool Ecosystem::SaveSnapshot(const std::string& path) const { 
+    auto start = std::chrono::steady_clock::now(); 
+
+    SnapshotHeader header{}; 
+    header.worldWidth = mWorldWidth; 
+    header.worldHeight = mWorldHeight; 
+    header.maxEntities = mMaxEntities; 
+    header.dayCycle = mDayCycle; 
+    header.worldSeed = mWorldSeed; 
+    header.worldDraws = mWorldDraws; 
+    header.nextEntityId = mEntities.GetNextId(); 
+    header.slotCount = mEntities.Size(); 
+    header.totalHerbivores = mStats.totalHerbivores; 
+    header.totalCarnivores = mStats.totalCarnivores; 
+    header.totalPlants = mStats.totalPlants; 
+    header.totalFood = mStats.totalFood; 
+    header.deathsToday = mStats.deathsToday; 
+    header.birthsToday = mStats.birthsToday; 
+    header.totalDeaths = mStats.totalDeaths; 
+    header.totalBirths = mStats.totalBirths; 
+    header.minimumPopulationToday = mMinimumPopulationToday; 
+    header.maximumPopulationToday = mMaximumPopulationToday; 
+
+    // Cases en 64 bits : même fichier quelle que soit la taille de size_t 
+    const std::vector<uint64_t> freeSlots(mEntities.GetFreeSlots().begin(), mEntities.GetFreeSlots().end()); 
+    const std::vector<uint64_t> pendingDeaths(mEntities.GetPendingDeaths().begin(), mEntities.GetPendingDeaths().end()); 
+
+    // Historique remis dans l'ordre chronologique 
+    std::vector<DayRecord> dayHistory; 
+    dayHistory.reserve(mDayHistoryCount); 
+    for (size_t daysAgo = mDayHistoryCount; daysAgo-- > 0;) { 
+        dayHistory.push_back(GetDayRecord(daysAgo)); 
+    }
+
+    SnapshotWriter writer(header); 
+    writer.AddSection(SnapshotSection::PositionX, mEntities.positionX); 
+    writer.AddSection(SnapshotSection::PositionY, mEntities.positionY); 
+    writer.AddSection(SnapshotSection::PreviousPositionX, mEntities.previousPositionX); 
+    writer.AddSection(SnapshotSection::PreviousPositionY, mEntities.previousPositionY); 
+    writer.AddSection(SnapshotSection::VelocityX, mEntities.velocityX); 
+    writer.AddSection(SnapshotSection::VelocityY, mEntities.velocityY); 
+    writer.AddSection(SnapshotSection::Energy, mEntities.energy); 
+    writer.AddSection(SnapshotSection::MaxEnergy, mEntities.maxEnergy); 
+    writer.AddSection(SnapshotSection::Age, mEntities.age); 
+    writer.AddSection(SnapshotSection::MaxAge, mEntities.maxAge); 
+    writer.AddSection(SnapshotSection::Type, mEntities.type); 
+    writer.AddSection(SnapshotSection::Alive, mEntities.alive); 
+    writer.AddSection(SnapshotSection::Id, mEntities.id); 
+    writer.AddSection(SnapshotSection::Size, mEntities.size); 
+    writer.AddSection(SnapshotSection::Color, mEntities.color); 
+    writer.AddSection(SnapshotSection::ParentId, mEntities.parentId); 
+    writer.AddSection(SnapshotSection::FreeSlots, freeSlots); 
+    writer.AddSection(SnapshotSection::PendingDeaths, pendingDeaths); 
+    writer.AddSection(SnapshotSection::Food, mFood.GetItems()); 
+    writer.AddSection(SnapshotSection::DayHistory, dayHistory); 
+    writer.AddSection(SnapshotSection::Species, std::vector<SpeciesParameters>(mSpecies.species.begin(), mSpecies.species.end())); 
+
+    if (!writer.WriteTo(path)) { 
+        ECO_LOG_WARNING("⚠ Instantané non écrit: " << path); 
+        return false; 
+    }
+    const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); 
+    ECO_LOG_INFO("💾 Instantané écrit: " << path << " (tick " << mDayCycle << ", " 
+                 << mEntities.LiveCount() << " entités, " << elapsedMs << " ms)"); 
+    return true; 
+} 
+
+// 📂 CHARGEMENT D'UN INSTANTANÉ : fichier projeté en mémoire, une copie par colonne 
+// Le monde courant n'est remplacé que si le fichier est complet et cohérent 
+bool Ecosystem::LoadSnapshot(const std::string& path) { 
+    auto start = std::chrono::steady_clock::now(); 
+
+    SnapshotReader reader; 
+    std::string error; 
+    if (!reader.Open(path, error)) { 
+        ECO_LOG_WARNING("⚠ Instantané refusé (" << path << "): " << error); 
+        return false; 
+    }
+    const SnapshotHeader& header = reader.GetHeader(); 
+    const size_t slotCount = static_cast<size_t>(header.slotCount); 
+
+    // 0. En-tête vérifié avant toute allocation : slotCount est borné par la taille du fichier 
+    // (chaque colonne en a autant d'éléments), maxEntities par SnapshotHeader::MaxEntities, 
+    // et les cases vivantes (ni libres, ni en attente de recyclage) par maxEntities 
+    const SnapshotSection entityColumns[] = { 
+        SnapshotSection::PositionX, SnapshotSection::PositionY, SnapshotSection::PreviousPositionX, 
+        SnapshotSection::PreviousPositionY, SnapshotSection::VelocityX, SnapshotSection::VelocityY, 
+        SnapshotSection::Energy, SnapshotSection::MaxEnergy, SnapshotSection::Age, SnapshotSection::MaxAge, 
+        SnapshotSection::Type, SnapshotSection::Alive, SnapshotSection::Id, SnapshotSection::Size, 
+        SnapshotSection::Color, SnapshotSection::ParentId}; 
+    const bool columnsSized = std::all_of(std::begin(entityColumns), std::end(entityColumns), 
+                                          [&](SnapshotSection id) { return reader.GetSectionCount(id) == header.slotCount; }); 
+    const uint64_t deadSlots = reader.GetSectionCount(SnapshotSection::FreeSlots) + 
+                               reader.GetSectionCount(SnapshotSection::PendingDeaths); 
+    const bool worldValid = std::isfinite(header.worldWidth) && std::isfinite(header.worldHeight) && 
+                            header.worldWidth > 0.0f && header.worldHeight > 0.0f; 
+    const bool capacityValid = header.maxEntities > 0 && header.maxEntities <= SnapshotHeader::MaxEntities && 
+                               deadSlots <= header.slotCount && 
+                               header.slotCount - deadSlots <= static_cast<uint64_t>(header.maxEntities); 
+    if (!columnsSized || !worldValid || !capacityValid) { 
+        ECO_LOG_WARNING("⚠ Instantané refusé (" << path << "): en-tête incohérent"); 
+        return false; 
+    }
+
+    // 1. Colonnes des entités, copiées d'un bloc dans un stockage temporaire 
+    // (capacité réservée d'abord : aucune recopie quand la population grandira) 
+    EntityStore loaded; 
+    loaded.Reserve(std::max(slotCount, static_cast<size_t>(header.maxEntities))); 
+    bool complete = true; 
+    auto readColumn = [&](SnapshotSection id, auto& column) { 
+        using Element = typename std::decay_t<decltype(column)>::value_type; 
+        const Element* data = reader.FindSection<Element>(id, slotCount); 
+        if (data) { 
+            column.assign(data, data + slotCount); 
+        } else { 
+            complete = false; 
+        }
+    }; 
+    readColumn(SnapshotSection::PositionX, loaded.positionX); 
+    readColumn(SnapshotSection::PositionY, loaded.positionY); 
+    readColumn(SnapshotSection::PreviousPositionX, loaded.previousPositionX); 
+    readColumn(SnapshotSection::PreviousPositionY, loaded.previousPositionY); 
+    readColumn(SnapshotSection::VelocityX, loaded.velocityX); 
+    readColumn(SnapshotSection::VelocityY, loaded.velocityY); 
+    readColumn(SnapshotSection::Energy, loaded.energy); 
+    readColumn(SnapshotSection::MaxEnergy, loaded.maxEnergy); 
+    readColumn(SnapshotSection::Age, loaded.age); 
+    readColumn(SnapshotSection::MaxAge, loaded.maxAge); 
+    readColumn(SnapshotSection::Type, loaded.type); 
+    readColumn(SnapshotSection::Alive, loaded.alive); 
+    readColumn(SnapshotSection::Id, loaded.id); 
+    readColumn(SnapshotSection::Size, loaded.size); 
+    readColumn(SnapshotSection::Color, loaded.color); 
+    readColumn(SnapshotSection::ParentId, loaded.parentId); 
+
+    // 2. Colonnes de taille libre 
+    const uint64_t freeCount = reader.GetSectionCount(SnapshotSection::FreeSlots); 
+    const uint64_t* freeSlots = reader.FindSection<uint64_t>(SnapshotSection::FreeSlots, freeCount); 
+    const uint64_t pendingCount = reader.GetSectionCount(SnapshotSection::PendingDeaths); 
+    const uint64_t* pendingDeaths = reader.FindSection<uint64_t>(SnapshotSection::PendingDeaths, pendingCount); 
+    const uint64_t foodCount = reader.GetSectionCount(SnapshotSection::Food); 
+    const Food* food = reader.FindSection<Food>(SnapshotSection::Food, foodCount); 
+    const uint64_t dayCount = reader.GetSectionCount(SnapshotSection::DayHistory); 
+    const DayRecord* days = reader.FindSection<DayRecord>(SnapshotSection::DayHistory, dayCount); 
+    const SpeciesParameters* species = reader.FindSection<SpeciesParameters>(SnapshotSection::Species, SpeciesCount); 
+    if (!complete || (freeCount > 0 && !freeSlots) || 
+        (pendingCount > 0 && !pendingDeaths) || (foodCount > 0 && !food) || (dayCount > 0 && !days) || 
+        dayCount > DayHistorySize || !species) { 
+        ECO_LOG_WARNING("⚠ Instantané refusé (" << path << "): colonne manquante ou de taille inattendue"); 
+        return false; 
+    }
+
+    // 3. Valeurs qui servent d'indices : un fichier corrompu ne doit pas sortir des tableaux 
+    const bool typesValid = std::all_of(loaded.type.begin(), loaded.type.end(), 
+                                        [](EntityType type) { return static_cast<size_t>(type) < SpeciesCount; }); 
+    // Cases libres et morts en attente : des cases mortes, chacune une seule fois, et toutes 
+    // les cases mortes (LiveCount s'en déduit ; une case vivante listée serait réoccupée par Add) 
+    bool slotsValid = std::all_of(loaded.alive.begin(), loaded.alive.end(), [](uint8_t flag) { return flag <= 1; }); 
+    std::vector<uint8_t> listed(slotCount, 0); 
+    auto claimDeadSlots = [&](const uint64_t* slots, uint64_t count) { 
+        for (uint64_t k = 0; k < count && slotsValid; ++k) { 
+            const uint64_t slot = slots[k]; 
+            slotsValid = slot < slotCount && !loaded.alive[slot] && !listed[slot]; 
+            if (slotsValid) listed[slot] = 1; 
+        } 
+    }; 
+    claimDeadSlots(freeSlots, freeCount); 
+    claimDeadSlots(pendingDeaths, pendingCount); 
+    const uint64_t deadCount = static_cast<uint64_t>(std::count(loaded.alive.begin(), loaded.alive.end(), uint8_t(0))); 
+    slotsValid = slotsValid && freeCount + pendingCount == deadCount; 
+    if (!typesValid || !slotsValid) { 
+        ECO_LOG_WARNING("⚠ Instantané refusé (" << path << "): contenu incohérent"); 
+        return false; 
+    }
+
+    loaded.RestoreSlots(header.nextEntityId, std::vector<size_t>(freeSlots, freeSlots + freeCount), 
+                        std::vector<size_t>(pendingDeaths, pendingDeaths + pendingCount)); 
+
+    // 4. Remplacement du monde courant 
+    mEntities = std::move(loaded); 
+    mWorldWidth = header.worldWidth; 
+    mWorldHeight = header.worldHeight; 
+    SetDomain({0.0f, 0.0f, mWorldWidth, mWorldHeight, 0});     // Un instantané décrit un monde entier 
+    mGhosts.clear(); 
+    mMaxEntities = header.maxEntities; 
+    mDayCycle = header.dayCycle; 
+    mWorldSeed = header.worldSeed; 
+    mWorldDraws = header.worldDraws; 
+    std::copy(species, species + SpeciesCount, mSpecies.species.begin()); 
+    mStats = {header.totalHerbivores, header.totalCarnivores, header.totalPlants, 
+              header.totalFood, header.deathsToday, header.birthsToday, 
+              header.dayCycle / TicksPerDay, header.totalDeaths, header.totalBirths}; 
+    mMinimumPopulationToday = header.minimumPopulationToday; 
+    mMaximumPopulationToday = header.maximumPopulationToday; 
+    std::copy(days, days + dayCount, mDayHistory.begin()); 
+    mDayHistoryCount = static_cast<size_t>(dayCount); 
+    mDayHistoryNext = mDayHistoryCount % DayHistorySize; 
+
+    mUnindexedEntities.clear(); 
+    mUnindexedEntities.reserve(mMaxEntities); 
+    mEntityGrid.Resize(mWorldWidth, mWorldHeight, Entity::PredatorPerceptionRadius); 
+    // Nourriture réinsérée dans l'ordre dense : mêmes réponses aux requêtes que le monde sauvegardé 
+    mFood.Clear(); 
+    mFood.Resize(mWorldWidth, mWorldHeight, Entity::PredatorPerceptionRadius); 
+    mFood.Reserve(static_cast<size_t>(foodCount)); 
+    for (uint64_t i = 0; i < foodCount; ++i) { 
+        mFood.Add(food[i]); 
+    }
+    RebuildSpatialIndex(); 
+    mProfiler.Reset(); 
+
+    const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); 
+    ECO_LOG_INFO("📂 Instantané chargé: " << path << " (tick " << mDayCycle << ", " 
+                 << mEntities.LiveCount() << " entités, " << elapsedMs << " ms)"); 
+    return true; 
+} 
+
+// 🔑 EMPREINTE DE L'ÉTAT 
+// FNV-1a sur des mots de 8 octets : rapide (quelques ms pour un million d'entités) et 
+// sensible au moindre bit. Les types hachés n'ont pas d'octets de remplissage. 
+static void HashBytes(uint64_t& hash, const void* data, size_t byteCount) { 
+    constexpr uint64_t Prime = 1099511628211ull; 
+    const unsigned char* bytes = static_cast<const unsigned char*>(data); 
+    size_t i = 0; 
+    for (; i + sizeof(uint64_t) <= byteCount; i += sizeof(uint64_t)) { 
+        uint64_t word; 
+        std::memcpy(&word, bytes + i, sizeof(word)); 
+        hash = (hash ^ word) * Prime; 
+    }
+    for (; i < byteCount; ++i) { 
+        hash = (hash ^ bytes[i]) * Prime; 
+    }
+} 
+
+template <typename T> 
+static void HashColumn(uint64_t& hash, const std::vector<T>& column) { 
+    static_assert(std::is_trivially_copyable<T>::value, "colonne hachée octet par octet"); 
+    const uint64_t count = column.size(); 
+    HashBytes(hash, &count, sizeof(count)); 
+    HashBytes(hash, column.data(), column.size() * sizeof(T)); 
+} 
+
+uint64_t Ecosystem::ComputeStateHash() const { 
+    uint64_t hash = 1469598103934665603ull; 
+    const uint64_t scalars[] = {static_cast<uint64_t>(mDayCycle), mWorldSeed, mWorldDraws, mEntities.GetNextId(), 
+                                static_cast<uint64_t>(mMinimumPopulationToday), static_cast<uint64_t>(mMaximumPopulationToday), 
+                                mDayHistoryCount}; 
+    HashBytes(hash, scalars, sizeof(scalars)); 
+    HashBytes(hash, &mStats, sizeof(mStats)); 
+    HashBytes(hash, mSpecies.species.data(), sizeof(mSpecies.species)); 
+
+    HashColumn(hash, mEntities.positionX); 
+    HashColumn(hash, mEntities.positionY); 
+    HashColumn(hash, mEntities.velocityX); 
+    HashColumn(hash, mEntities.velocityY); 
+    HashColumn(hash, mEntities.energy); 
+    HashColumn(hash, mEntities.maxEnergy); 
+    HashColumn(hash, mEntities.age); 
+    HashColumn(hash, mEntities.maxAge); 
+    HashColumn(hash, mEntities.type); 
+    HashColumn(hash, mEntities.alive); 
+    HashColumn(hash, mEntities.id); 
+    HashColumn(hash, mEntities.size); 
+    HashColumn(hash, mEntities.color); 
+    HashColumn(hash, mEntities.parentId); 
+    HashColumn(hash, mEntities.GetFreeSlots()); 
+    HashColumn(hash, mEntities.GetPendingDeaths()); 
+    HashColumn(hash, mFood.GetItems()); 
+    for (size_t day = 0; day < mDayHistoryCount; ++day) { 
+        HashBytes(hash, &GetDayRecord(day), sizeof(DayRecord)); 
+    }
+    return hash; 
+} 
+
 // MISE À JOUR 
 void Ecosystem::Update(float deltaTime) { 
-    // Mise à jour de toutes les entités 
-    for (auto& entity : mEntities) { 
-        entity->Update(deltaTime); 
-    }
+    // Chaque phase se chronomètre elle-même ; cette portée couvre le tick entier 
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::Tick);
+
+    // Cases des morts du tick précédent libérées avant la reconstruction de la grille : 
+    // aucune case encore indexée ne peut être réoccupée pendant ce tick 
+    RemoveDeadEntities(); 
+    // Positions de départ du pas, pour l'interpolation du rendu 
+    mEntities.SavePreviousPositions(); 
+    // Mise à jour de toutes les entités (passes parallèles sur les tableaux) 
+    UpdateEntities(deltaTime); 
+    // Index spatial sur les positions après déplacement 
+    RebuildSpatialIndex(); 
     // Gestion des comportements 
+    HandleBehaviors(deltaTime); 
     HandleEating(); 
     HandleReproduction(); 
-    RemoveDeadEntities(); 
     HandlePlantGrowth(deltaTime); 
     // Mise à jour des statistiques 
     UpdateStatistics(); 
     mDayCycle++; 
+    if (mDayCycle % TicksPerDay == 0) { 
+        RollOverDay(); 
+    }
 } 
 
 // GÉNÉRATION DE NOURRITURE 
 void Ecosystem::SpawnFood(int count) { 
     for (int i = 0; i < count; ++i) { 
-        if (mFoodSources.size() < 100) {  // Limite maximale de nourriture 
-            Vector2D position = GetRandomPosition(); 
-            mFoodSources.emplace_back(position, 25.0f); 
-        } 
+        CounterRandom random = NextWorldRandom(); 
+        mFood.Add(Food(GetRandomPosition(random), 25.0f)); 
     }
  } 
 
-// SUPPRESSION DES ENTITÉS MORTES 
+// RECYCLAGE DES CASES DES ENTITÉS MORTES 
 void Ecosystem::RemoveDeadEntities() { 
-    int initialCount = mEntities.size(); 
-
-    mEntities.erase( 
-        std::remove_if(mEntities.begin(), mEntities.end(), 
-            [](const std::unique_ptr<Entity>& entity) {  
-                return !entity->IsAlive();  
-            }), 
-        mEntities.end() 
-    ); 
-    
-    int removedCount = initialCount - mEntities.size(); 
-    if (removedCount > 0) { 
-        mStats.deathsToday += removedCount; 
-    }
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::RemoveDeadEntities); 
+    mEntities.RecycleDead(); 
  } 
 
 // GESTION DE LA REPRODUCTION 
 void Ecosystem::HandleReproduction() {
-    std::vector<std::unique_ptr<Entity>> newEntities;
-    
-    for (auto& entity : mEntities) {
-        if (entity->CanReproduce() && mEntities.size() < mMaxEntities) {
-            auto baby = entity->Reproduce();
-            if (baby) {
-                newEntities.push_back(std::move(baby));
-                mStats.birthsToday++;
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::Reproduction);
+    // 1. Tirages en parallèle : chaque tranche consigne ses parents
+    const size_t parentCount = mEntities.Size();
+    PrepareChunks(parentCount);
+    const uint32_t tick = CurrentTick();
+    mJobSystem->ParallelFor(parentCount, UpdateChunkSize, [this, tick](size_t chunk, size_t begin, size_t end) {
+        LifeCycleCommands& commands = mChunkCommands[chunk];
+        for (size_t i = begin; i < end; ++i) {
+            if (Entity(mEntities, i).Reproduce(mWorldSeed, tick)) {
+                commands.birthParents.push_back(i);
             }
         }
-    }
-    
-    // Ajout des nouveaux entités
-    for (auto& newEntity : newEntities) {
-        mEntities.push_back(std::move(newEntity));
+    });
+
+    // 2. Naissances dans l'ordre des tranches : la limite de population est appliquée de façon déterministe
+    // (les enfants occupent les cases libérées au tick précédent ou la fin des tableaux, jamais celle d'un parent)
+    const size_t chunkCount = JobSystem::ChunkCount(parentCount, UpdateChunkSize);
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        for (size_t parentIndex : mChunkCommands[chunk].birthParents) {
+            if (mEntities.LiveCount() >= static_cast<size_t>(mMaxEntities)) return;
+            Entity child = Entity::CreateOffspring(mEntities, parentIndex);
+            mUnindexedEntities.push_back(child.GetIndex());
+            mStats.birthsToday++;
+            mStats.totalBirths++;
+        }
     }
 }
 
 // 🍽 GESTION DE L'ALIMENTATION 
+// 1. Repas sans proie (photosynthèse, nourriture au sol) : une espèce après l'autre, chacune 
+//    dans l'ordre des cases (seuls les herbivores touchent à la nourriture au sol) 
+// 2. Phase large : chaque mangeur affamé propose la proie la plus proche qu'il touche 
+//    (distance <= somme des rayons), trouvée par la grille ; en parallèle, lecture seule 
+// 3. Conflits : une proie n'a qu'un mangeur par tick, le plus proche, puis le plus petit ID 
+// 4. Repas et morts appliqués en lot, dans l'ordre des propositions (espèce, puis case) 
+// Chaque étape est linéaire : une requête de quelques cellules par mangeur, un passage par repas. 
 void Ecosystem::HandleEating() { 
-    // Ici on implémenterait la logique de recherche de nourriture 
-    // Pour l'instant, gestion simplifiée 
-    for (auto& entity : mEntities) { 
-        if (entity->GetType() == EntityType::PLANT) { 
-            // Les plantes génèrent de l'énergie 
-            entity->Eat(0.1f); 
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::Eating); 
+    ForEachSpecies([this](auto species) { FeedSpecies<decltype(species)>(); }); 
+
+    mMeals.clear(); 
+    ForEachSpecies([this](auto species) { 
+        using Species = decltype(species); 
+        if constexpr (SpeciesTraits<Species>::HasPrey) { 
+            ProposeMeals<Species>(); 
+        } 
+    }); 
+    if (mMeals.empty()) return; 
+
+    // Attribution des proies (NoClaim partout en dehors de cette phase) 
+    if (mPreyClaims.size() < mEntities.Size()) { 
+        mPreyClaims.resize(mEntities.Size(), NoClaim); 
+    } 
+    for (uint32_t m = 0; m < mMeals.size(); ++m) { 
+        const LifeCycleCommands::Meal& meal = mMeals[m]; 
+        uint32_t& claim = mPreyClaims[meal.prey]; 
+        if (claim == NoClaim) { 
+            claim = m; 
+            continue; 
+        } 
+        const LifeCycleCommands::Meal& held = mMeals[claim]; 
+        if (meal.distanceSquared < held.distanceSquared || 
+            (meal.distanceSquared == held.distanceSquared && mEntities.id[meal.eater] < mEntities.id[held.eater])) { 
+            claim = m; 
+        } 
+    }
+
+    // Repas retenus : la proie perd ce qui est mangé et meurt si plus rien ne reste 
+    for (uint32_t m = 0; m < mMeals.size(); ++m) { 
+        const LifeCycleCommands::Meal& meal = mMeals[m]; 
+        if (mPreyClaims[meal.prey] != m) continue; 
+        // Mangeur déjà dévoré plus tôt dans le lot (chaîne alimentaire à plus de deux niveaux) 
+        if (!mEntities.alive[meal.eater] || !mEntities.alive[meal.prey]) continue; 
+        float& preyEnergy = mEntities.energy[meal.prey]; 
+        const float eaten = std::min(meal.bite, preyEnergy); 
+        preyEnergy -= eaten; 
+        Entity(mEntities, meal.eater).Eat(eaten); 
+        if (preyEnergy <= 0.0f) { 
+            mEntities.Kill(meal.prey); 
+            mStats.deathsToday++; 
+            mStats.totalDeaths++; 
+            ECO_LOG_DEBUG("🦴" << Entity(mEntities, meal.prey).GetName().GetText() << " dévoré par " 
+                          << Entity(mEntities, meal.eater).GetName().GetText()); 
         } 
     }
+    for (const LifeCycleCommands::Meal& meal : mMeals) { 
+        mPreyClaims[meal.prey] = NoClaim; 
+    }
  } 
 
-// MISE À JOUR DES STATISTIQUES 
-void Ecosystem::UpdateStatistics() { 
-    mStats.totalHerbivores = 0; 
-    mStats.totalCarnivores = 0; 
-    mStats.totalPlants = 0; 
-    mStats.totalFood = mFoodSources.size(); 
-    for (const auto& entity : mEntities) { 
-        switch (entity->GetType()) { 
-            case EntityType::HERBIVORE: 
-                mStats.totalHerbivores++; 
-                break; 
-            case EntityType::CARNIVORE: 
-                mStats.totalCarnivores++; 
-                break; 
-            case EntityType::PLANT: 
-                mStats.totalPlants++; 
-                break; 
+// 🎯 PHASE LARGE D'UNE ESPÈCE : au plus une proposition par mangeur, par tranche puis dans l'ordre des tranches 
+template <typename Species> 
+void Ecosystem::ProposeMeals() { 
+    using Traits = SpeciesTraits<Species>; 
+    // Paramètres regroupés sur la pile : la capture tient dans std::function sans allocation 
+    // (rayon de requête : demi-taille du mangeur + celle de la plus grande proie vivante) 
+    struct Context { 
+        const std::vector<uint32_t>& members; 
+        float largestPreyRadius; 
+    } context{mSpeciesMembers[static_cast<size_t>(Traits::Type)], mLargestSize[static_cast<size_t>(Traits::Prey)] * 0.5f}; 
+    PrepareChunks(context.members.size()); 
+    mJobSystem->ParallelFor(context.members.size(), UpdateChunkSize, [this, &context](size_t chunk, size_t begin, size_t end) { 
+        const std::vector<uint32_t>& members = context.members; 
+        const float largestPreyRadius = context.largestPreyRadius; 
+        std::vector<LifeCycleCommands::Meal>& meals = mChunkCommands[chunk].meals; 
+        constexpr uint32_t preyMask = SpatialGrid::MaskOf(static_cast<int>(Traits::Prey)); 
+        for (size_t m = begin; m < end; ++m) { 
+            const uint32_t eater = members[m]; 
+            if (mEntities.energy[eater] >= mEntities.maxEnergy[eater]) continue;   // Rassasié 
+            const Vector2D position = mEntities.GetPosition(eater); 
+            const float eaterRadius = mEntities.size[eater] * 0.5f; 
+            const SpatialGrid::Item* prey = mEntityGrid.FindNearest(position, eaterRadius + largestPreyRadius, preyMask, 
+                [&](const SpatialGrid::Item& item) { 
+                    if (item.index < 0) return false;      // Fantôme : proie d'un autre éclat 
+                    const float contact = eaterRadius + mEntities.size[item.index] * 0.5f; 
+                    return (item.position - position).LengthSquared() <= contact * contact; 
+                }); 
+            if (prey) { 
+                meals.push_back({eater, static_cast<uint32_t>(prey->index), 
+                                 (prey->position - position).LengthSquared(), Traits::BiteEnergy}); 
+            } 
+        }
+    }); 
+
+    const size_t chunkCount = JobSystem::ChunkCount(context.members.size(), UpdateChunkSize); 
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) { 
+        const std::vector<LifeCycleCommands::Meal>& meals = mChunkCommands[chunk].meals; 
+        mMeals.insert(mMeals.end(), meals.begin(), meals.end()); 
+    }
+} 
+
+template <typename Species> 
+void Ecosystem::FeedSpecies() { 
+    using Traits = SpeciesTraits<Species>; 
+    for (uint32_t index : mSpeciesMembers[static_cast<size_t>(Traits::Type)]) { 
+        Entity entity(mEntities, index); 
+        if constexpr (Traits::EnergyPerTick > 0.0f) { 
+            // Les plantes génèrent de l'énergie 
+            entity.Eat(Traits::EnergyPerTick); 
+        } 
+        if constexpr (Traits::EatsGroundFood) { 
+            // Les herbivores mangent la nourriture au contact (requête locale, retrait immédiat en O(1)) 
+            float reach = entity.GetSize() / 2.0f + 3.0f; 
+            const FoodHandle food = mFood.FindNearest(entity.GetPosition(), reach); 
+            if (!food.IsNull()) { 
+                entity.Eat(mFood.Get(food).energyValue); 
+                mFood.Remove(food); 
+            } 
+        } 
+    }
+} 
+
+// 🗺 RECONSTRUCTION DE L'INDEX SPATIAL 
+void Ecosystem::RebuildSpatialIndex() { 
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::SpatialIndex); 
+    mEntityGrid.Clear(); 
+    for (auto& members : mSpeciesMembers) { 
+        members.clear(); 
+    }
+    mLargestSize.fill(0.0f); 
+    for (size_t i = 0; i < mEntities.Size(); ++i) { 
+        if (mEntities.alive[i]) { 
+            const size_t type = static_cast<size_t>(mEntities.type[i]); 
+            mEntityGrid.Insert(mEntities.GetPosition(i), static_cast<int>(i), static_cast<int>(type)); 
+            mSpeciesMembers[type].push_back(static_cast<uint32_t>(i)); 
+            mLargestSize[type] = std::max(mLargestSize[type], mEntities.size[i]); 
         } 
     }
+    // Fantômes perçus comme les autres, sans case dans mEntities (indice -1 - rang) 
+    for (size_t g = 0; g < mGhosts.size(); ++g) { 
+        mEntityGrid.Insert(mGhosts[g].position, -1 - static_cast<int>(g), static_cast<int>(mGhosts[g].type)); 
+    }
+    mEntityGrid.Build(); 
+    mUnindexedEntities.clear(); 
+    // La nourriture ne bouge pas : mFood tient son index à jour lui-même 
+} 
+
+// 🧭 COMPORTEMENTS : recherche de nourriture, fuite et maintien dans le monde 
+// (lecture seule des grilles, chaque tranche n'écrit que ses propres vitesses) 
+void Ecosystem::HandleBehaviors(float deltaTime) { 
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::Behaviors); 
+    ForEachSpecies([this, deltaTime](auto species) { 
+        using Species = decltype(species); 
+        if constexpr (SpeciesTraits<Species>::IsMobile) { 
+            BehaveSpecies<Species>(deltaTime); 
+        } 
+    }); 
+} 
+
+template <typename Species> 
+void Ecosystem::BehaveSpecies(float deltaTime) { 
+    // Paramètres regroupés sur la pile : la capture tient dans std::function sans allocation 
+    struct Context { 
+        const std::vector<uint32_t>& members; 
+        float deltaTime; 
+    } context{mSpeciesMembers[static_cast<size_t>(SpeciesTraits<Species>::Type)], deltaTime}; 
+    mJobSystem->ParallelFor(context.members.size(), UpdateChunkSize, [this, &context](size_t, size_t begin, size_t end) { 
+        const float deltaTime = context.deltaTime; 
+        for (size_t m = begin; m < end; ++m) { 
+            Entity entity(mEntities, context.members[m]); 
+            Vector2D steering = entity.SeekFood<Species>(mEntityGrid, mFood) 
+                              + entity.AvoidPredators<Species>(mEntityGrid) * 0.05f 
+                              + entity.StayInBounds(mWorldWidth, mWorldHeight) * 0.05f; 
+            entity.ApplyForce<Species>(steering * deltaTime); 
+        }
+    }); 
+} 
+
+// ⚙ CYCLE DE VIE EN PARALLÈLE, MORTS APPLIQUÉES DANS L'ORDRE DES TRANCHES 
+void Ecosystem::UpdateEntities(float deltaTime) { 
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::UpdateEntities); 
+    const size_t count = mEntities.Size(); 
+    PrepareChunks(count); 
+    const uint32_t tick = CurrentTick(); 
+    mJobSystem->ParallelFor(count, UpdateChunkSize, [this, deltaTime, tick](size_t chunk, size_t begin, size_t end) { 
+        Entity::UpdateRange(mEntities, begin, end, deltaTime, mSpecies, mWorldSeed, tick, mChunkCommands[chunk]); 
+    }); 
+
+    const size_t chunkCount = JobSystem::ChunkCount(count, UpdateChunkSize); 
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) { 
+        for (const auto& death : mChunkCommands[chunk].deaths) { 
+            Entity::ApplyDeath(mEntities, death); 
+        } 
+        const int deaths = static_cast<int>(mChunkCommands[chunk].deaths.size()); 
+        mStats.deathsToday += deaths; 
+        mStats.totalDeaths += deaths; 
+    }
+} 
+
+// 📨 FILES DE COMMANDES : une par tranche, vidées mais jamais libérées 
+void Ecosystem::PrepareChunks(size_t count) { 
+    const size_t chunkCount = JobSystem::ChunkCount(count, UpdateChunkSize); 
+    if (mChunkCommands.size() < chunkCount) { 
+        mChunkCommands.resize(chunkCount); 
+        mChunkTotals.resize(chunkCount); 
+    } 
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) { 
+        mChunkCommands[chunk].Clear(); 
+    }
+} 
+
+// 🎲 GRAINE DU MONDE (même graine + même configuration = même simulation) 
+void Ecosystem::SetSeed(uint64_t seed) { 
+    mWorldSeed = seed; 
+    mWorldDraws = 0; 
+} 
+
+// 🎲 FLUX DU MONDE : un nouveau sujet à chaque appel, hors de la boucle parallèle 
+// (l'éclat occupe les bits hauts du sujet : 0 pour un monde seul) 
+CounterRandom Ecosystem::NextWorldRandom() { 
+    const uint64_t subject = (static_cast<uint64_t>(mDomain.shard) << 32) | mWorldDraws++; 
+    return CounterRandom(mWorldSeed, subject, CurrentTick(), RandomStream::World); 
+} 
+
+// 🧩 DOMAINE POSSÉDÉ 
+void Ecosystem::SetDomain(const WorldDomain& domain) { 
+    mDomain = domain; 
+    const float area = (domain.maxX - domain.minX) * (domain.maxY - domain.minY); 
+    mDomainFraction = area / (mWorldWidth * mWorldHeight); 
+} 
+
+// 📤 DÉPART D'UNE ENTITÉ VERS UN AUTRE DOMAINE (case libérée au tick suivant, comme un mort) 
+EntityRecord Ecosystem::ReleaseEntity(size_t index) { 
+    EntityRecord record = mEntities.Extract(index); 
+    mEntities.Kill(index); 
+    return record; 
+} 
+
+// 📥 ARRIVÉE D'UNE ENTITÉ D'UN AUTRE DOMAINE 
+void Ecosystem::AdoptEntity(const EntityRecord& record) { 
+    mUnindexedEntities.push_back(mEntities.Insert(record)); 
+} 
+
+// 🧵 NOMBRE DE THREADS (sans effet sur les résultats) 
+void Ecosystem::SetThreadCount(int threadCount) { 
+    mJobSystem = std::make_unique<JobSystem>(threadCount); 
+} 
+
+// MISE À JOUR DES STATISTIQUES : compteurs déjà à jour, rien à parcourir 
+void Ecosystem::UpdateStatistics() { 
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::Statistics); 
+    mStats.totalHerbivores = static_cast<int>(mEntities.LiveCount(EntityType::HERBIVORE)); 
+    mStats.totalCarnivores = static_cast<int>(mEntities.LiveCount(EntityType::CARNIVORE)); 
+    mStats.totalPlants = static_cast<int>(mEntities.LiveCount(EntityType::PLANT)); 
+    mStats.totalFood = static_cast<int>(mFood.Size()); 
+    mStats.day = mDayCycle / TicksPerDay; 
+
+    const int population = static_cast<int>(mEntities.LiveCount()); 
+    mMinimumPopulationToday = std::min(mMinimumPopulationToday, population); 
+    mMaximumPopulationToday = std::max(mMaximumPopulationToday, population); 
+
+    if (mStatisticsRecorder.IsOpen()) { 
+        RecordStatistics(); 
+    }
+ } 
+
+// 📼 LIGNE ENREGISTRÉE : seule passe sur la population, et seulement pendant un enregistrement 
+void Ecosystem::RecordStatistics() { 
+    // Sommes par tranche, puis dans l'ordre des tranches (réduction déterministe) 
+    const size_t count = mEntities.Size(); 
+    PrepareChunks(count); 
+    mJobSystem->ParallelFor(count, UpdateChunkSize, [this](size_t chunk, size_t begin, size_t end) { 
+        ChunkTotals totals = {}; 
+        for (size_t i = begin; i < end; ++i) { 
+            if (!mEntities.alive[i]) continue; 
+            const size_t type = static_cast<size_t>(mEntities.type[i]); 
+            totals.energy[type] += mEntities.energy[i]; 
+            totals.age[type] += mEntities.age[i]; 
+        }
+        mChunkTotals[chunk] = totals; 
+    }); 
+
+    ChunkTotals world = {}; 
+    const size_t chunkCount = JobSystem::ChunkCount(count, UpdateChunkSize); 
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) { 
+        for (size_t type = 0; type < SpeciesCount; ++type) { 
+            world.energy[type] += mChunkTotals[chunk].energy[type]; 
+            world.age[type] += mChunkTotals[chunk].age[type]; 
+        }
+    }
+
+    StatisticsSample sample; 
+    sample.herbivores = mStats.totalHerbivores; 
+    sample.carnivores = mStats.totalCarnivores; 
+    sample.plants = mStats.totalPlants; 
+    sample.food = mStats.totalFood; 
+    sample.birthsToday = mStats.birthsToday; 
+    sample.deathsToday = mStats.deathsToday; 
+    sample.entities = static_cast<int32_t>(mEntities.LiveCount()); 
+    for (size_t type = 0; type < sample.averageEnergy.size(); ++type) { 
+        const size_t population = mEntities.LiveCount(static_cast<EntityType>(type)); 
+        sample.averageEnergy[type] = population > 0 ? static_cast<float>(world.energy[type] / population) : 0.0f; 
+        sample.averageAge[type] = population > 0 ? static_cast<float>(world.age[type] / population) : 0.0f; 
+    }
+    mStatisticsRecorder.Record(CurrentTick(), sample); 
+ } 
+
+// 📅 CHANGEMENT DE JOUR : bilan dans l'historique, compteurs du jour remis à zéro 
+void Ecosystem::RollOverDay() { 
+    DayRecord& record = mDayHistory[mDayHistoryNext]; 
+    record.day = mDayCycle / TicksPerDay - 1; 
+    record.births = mStats.birthsToday; 
+    record.deaths = mStats.deathsToday; 
+    record.herbivores = mStats.totalHerbivores; 
+    record.carnivores = mStats.totalCarnivores; 
+    record.plants = mStats.totalPlants; 
+    record.minimumPopulation = mMinimumPopulationToday; 
+    record.maximumPopulation = mMaximumPopulationToday; 
+    mDayHistoryNext = (mDayHistoryNext + 1) % DayHistorySize; 
+    mDayHistoryCount = std::min(mDayHistoryCount + 1, DayHistorySize); 
+
+    ECO_LOG_INFO("📅 Jour " << record.day << " terminé - Naissances: " << record.births 
+                 << ", Morts: " << record.deaths << ", Population: " << record.minimumPopulation 
+                 << " à " << record.maximumPopulation); 
+
+    mStats.birthsToday = 0; 
+    mStats.deathsToday = 0; 
+    mStats.day = mDayCycle / TicksPerDay; 
+    const int population = static_cast<int>(mEntities.LiveCount()); 
+    mMinimumPopulationToday = population; 
+    mMaximumPopulationToday = population; 
+ } 
+
+// ♻ STATISTIQUES ET HISTORIQUE À ZÉRO (nouveau monde) 
+void Ecosystem::ResetStatistics() { 
+    mStats = {0, 0, 0, 0, 0, 0, 0, 0, 0}; 
+    mMinimumPopulationToday = 0; 
+    mMaximumPopulationToday = 0; 
+    mDayHistoryNext = 0; 
+    mDayHistoryCount = 0; 
  } 
 
 // CRÉATION D'ENTITÉ ALÉATOIRE 
 void Ecosystem::SpawnRandomEntity(EntityType type) { 
-    if (mEntities.size() >= mMaxEntities) return; 
-    Vector2D position = GetRandomPosition(); 
-    std::string name; 
-    switch (type) { 
-        case EntityType::HERBIVORE: 
-            name = "Herbivore_" + std::to_string(mStats.totalHerbivores); 
-            break; 
-        case EntityType::CARNIVORE: 
-            name = "Carnivore_" + std::to_string(mStats.totalCarnivores); 
-            break; 
-        case EntityType::PLANT: 
-            name = "Plant_" + std::to_string(mStats.totalPlants); 
-            break; 
-    }
-    mEntities.push_back(std::make_unique<Entity>(type, position, name)); 
-} 
-
-// POSITION ALÉATOIRE 
-Vector2D Ecosystem::GetRandomPosition() { 
-    std::uniform_real_distribution<float> distX(0.0f, mWorldWidth); 
-    std::uniform_real_distribution<float> distY(0.0f, mWorldHeight); 
-    return Vector2D(distX(mRandomGenerator), distY(mRandomGenerator)); 
+    if (mEntities.LiveCount() >= static_cast<size_t>(mMaxEntities)) return; 
+    CounterRandom random = NextWorldRandom(); 
+    Vector2D position = GetRandomPosition(random); 
+    Entity entity = Entity::Create(mEntities, type, position, random, mSpecies[type]); 
+    mUnindexedEntities.push_back(entity.GetIndex()); 
+} 
+
+// POSITION ALÉATOIRE (dans le domaine possédé) 
+Vector2D Ecosystem::GetRandomPosition(CounterRandom& random) const { 
+    float x = random.NextFloat(mDomain.minX, mDomain.maxX); 
+    float y = random.NextFloat(mDomain.minY, mDomain.maxY); 
+    return Vector2D(x, y); 
 } 
 
 // CROISSANCE DES PLANTES 
 void Ecosystem::HandlePlantGrowth(float deltaTime) { 
+    ECO_PROFILE_SCOPE(mProfiler, ProfilePhase::PlantGrowth); 
     // Occasionnellement, faire pousser de nouvelles plantes 
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f); 
-    if (chance(mRandomGenerator) < 0.01f && mEntities.size() < mMaxEntities) { 
+    // (fréquence au prorata du domaine : un monde réparti pousse au même rythme qu'un monde seul) 
+    if (NextWorldRandom().NextFloat() < 0.01f * mDomainFraction && mEntities.LiveCount() < static_cast<size_t>(mMaxEntities)) { 
         SpawnRandomEntity(EntityType::PLANT); 
     }
  } 
 
-// RENDU 
-void Ecosystem::Render(SDL_Renderer* renderer) const { 
-    // Rendu de la nourriture 
-    for (const auto& food : mFoodSources) { 
-        SDL_FRect rect = { 
-            food.position.x - 3.0f, 
-            food.position.y - 3.0f, 
-            6.0f, 
-            6.0f 
-        };
-        SDL_SetRenderDrawColor(renderer, food.color.r, food.color.g, food.color.b, food.color.a);
-        SDL_RenderFillRect(renderer, &rect); 
-    }
-    // Rendu des entités 
-    for (const auto& entity : mEntities) { 
-        entity->Render(renderer); 
-    }
-} 
-
 // mes implémentation
 
-void Ecosystem::AddEntity(std::unique_ptr<Entity> entity) {
-    if (mEntities.size() < mMaxEntities && entity) {
-        mEntities.push_back(std::move(entity));
-    }
+bool Ecosystem::AddEntity(EntityType type, Vector2D position) {
+    if (mEntities.LiveCount() >= static_cast<size_t>(mMaxEntities)) return false;
+    CounterRandom random = NextWorldRandom();
+    Entity entity = Entity::Create(mEntities, type, position, random, mSpecies[type]);
+    mUnindexedEntities.push_back(entity.GetIndex());
+    return true;
 }
 
 void Ecosystem::AddFood(Vector2D position, float energy) {
-   if (mFoodSources.size() < 100) {
-    mFoodSources.emplace_back(positon, energy);
-   }
+    mFood.Add(Food(position, energy));
 }
 
 
@@ -0,0 +1,299 @@
+#include "Core/EnsembleRunner.h"
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include "Core/SpeciesTraits.h"
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🔢 LECTURE D'UNE VALEUR (le jeton entier doit être un nombre)
+static bool ParseNumber(const std::string& token, double& value) {
+    char* end = nullptr;
+    value = std::strtod(token.c_str(), &end);
+    return end != token.c_str() && *end == '\0';
+}
+
+static bool ParseCount(const std::string& token, long long& value) {
+    char* end = nullptr;
+    value = std::strtoll(token.c_str(), &end, 10);
+    return end != token.c_str() && *end == '\0' && value >= 0;
+}
+
+static bool ParseSeed(const std::string& token, uint64_t& value) {
+    if (token.empty() || token[0] == '-') return false;
+    char* end = nullptr;
+    value = std::strtoull(token.c_str(), &end, 10);
+    return end != token.c_str() && *end == '\0';
+}
+
+// 🧬 CHAMP D'UNE ESPÈCE : « carnivore.drain » → table[CARNIVORE].energyDrainPerSecond
+static float* FindSpeciesField(const std::string& key, SpeciesTable& table) {
+    const size_t dot = key.find('.');
+    if (dot == std::string::npos) return nullptr;
+    const std::string name = key.substr(0, dot);
+    const std::string field = key.substr(dot + 1);
+
+    const auto match = std::find(SpeciesKeys.begin(), SpeciesKeys.end(), name);
+    if (match == SpeciesKeys.end()) return nullptr;
+
+    SpeciesParameters& species = table.species[static_cast<size_t>(match - SpeciesKeys.begin())];
+    if (field == "energy") return &species.initialEnergy;
+    if (field == "max-energy") return &species.maxEnergy;
+    if (field == "max-age") return &species.maxAge;
+    if (field == "size") return &species.size;
+    if (field == "drain") return &species.energyDrainPerSecond;
+    return nullptr;
+}
+
+// ⚙ UNE VALEUR DANS LA CONFIGURATION
+bool SweepDescription::ApplyValue(const std::string& key, const std::string& value, HeadlessConfig& config) {
+    if (key == "seed") {
+        return ParseSeed(value, config.seed);
+    }
+
+    double number = 0.0;
+    long long count = 0;
+    if (key == "ticks") {
+        if (!ParseCount(value, count) || count == 0) return false;
+        config.maxTicks = count;
+        config.maxSimulatedTime = 0.0f;
+    } else if (key == "max-entities") {
+        if (!ParseCount(value, count) || count == 0) return false;
+        config.maxEntities = static_cast<int>(count);
+    } else if (key == "herbivores" || key == "carnivores" || key == "plants") {
+        if (!ParseCount(value, count)) return false;
+        int& target = key == "herbivores" ? config.initialHerbivores
+                    : key == "carnivores" ? config.initialCarnivores : config.initialPlants;
+        target = static_cast<int>(count);
+    } else if (key == "dt" || key == "world-width" || key == "world-height") {
+        if (!ParseNumber(value, number) || number <= 0.0) return false;
+        float& target = key == "dt" ? config.tickDuration
+                      : key == "world-width" ? config.worldWidth : config.worldHeight;
+        target = static_cast<float>(number);
+    } else {
+        float* field = FindSpeciesField(key, config.species);
+        if (!field || !ParseNumber(value, number)) return false;
+        *field = static_cast<float>(number);
+    }
+    return true;
+}
+
+// 📂 LECTURE D'UN FICHIER DE BALAYAGE
+bool SweepDescription::Load(const std::string& path, SweepDescription& sweep, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = "fichier illisible";
+        return false;
+    }
+
+    SweepDescription result;
+    bool hasSeeds = false;
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        const size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        std::istringstream in(line);
+        SweepAxis axis;
+        if (!(in >> axis.key)) continue;
+        for (std::string value; in >> value;) axis.values.push_back(value);
+
+        const std::string where = "ligne " + std::to_string(lineNumber) + " (" + axis.key + "): ";
+        if (axis.values.empty()) {
+            error = where + "aucune valeur";
+            return false;
+        }
+        bool duplicate = axis.key == "seed" ? hasSeeds : false;
+        for (const SweepAxis& other : result.axes) duplicate = duplicate || other.key == axis.key;
+        if (duplicate) {
+            error = where + "clé répétée";
+            return false;
+        }
+
+        // 1. Graines : liste et intervalles A..B, développés ici
+        if (axis.key == "seed") {
+            hasSeeds = true;
+            for (const std::string& value : axis.values) {
+                const size_t range = value.find("..");
+                uint64_t first = 0;
+                uint64_t last = 0;
+                const bool valid = range == std::string::npos
+                                 ? ParseSeed(value, first) && ParseSeed(value, last)
+                                 : ParseSeed(value.substr(0, range), first) && ParseSeed(value.substr(range + 2), last);
+                if (!valid || first == 0 || last < first) {
+                    error = where + "graine invalide « " + value + " » (entier non nul ou intervalle A..B)";
+                    return false;
+                }
+                for (uint64_t seed = first; ; ++seed) {
+                    result.seeds.push_back(seed);
+                    if (seed == last) break;
+                }
+            }
+            continue;
+        }
+
+        // 2. Autres clés : chaque valeur est vérifiée sur une configuration témoin
+        HeadlessConfig probe;
+        for (const std::string& value : axis.values) {
+            if (!ApplyValue(axis.key, value, probe)) {
+                error = where + "clé inconnue ou valeur invalide « " + value + " »";
+                return false;
+            }
+        }
+        result.axes.push_back(std::move(axis));
+    }
+
+    sweep = std::move(result);
+    return true;
+}
+
+size_t SweepDescription::GetConfigurationCount() const {
+    size_t count = 1;
+    for (const SweepAxis& axis : axes) count *= axis.values.size();
+    return count;
+}
+
+// 🏗 CONSTRUCTEUR
+EnsembleRunner::EnsembleRunner(const HeadlessConfig& base, const SweepDescription& sweep)
+    : mBase(base),
+      mSweep(sweep),
+      mWallSeconds(0.0)
+{
+    // Un monde par thread : le parallélisme vient du nombre d'exécutions simultanées
+    mBase.threadCount = 1;
+    mBase.profileCsvPath.clear();
+    mBase.loadSnapshotPath.clear();
+    mBase.saveSnapshotPath.clear();
+    mBase.statisticsPath.clear();
+    mBase.statisticsCsvPath.clear();
+    mBase.recordPath.clear();
+}
+
+// 🔀 CONFIGURATION D'UNE EXÉCUTION : indice décomposé axe par axe, graine en premier
+HeadlessConfig EnsembleRunner::MakeConfig(size_t runIndex, RunResult& run) const {
+    HeadlessConfig config = mBase;
+    const size_t seedCount = mSweep.seeds.empty() ? 1 : mSweep.seeds.size();
+    if (!mSweep.seeds.empty()) config.seed = mSweep.seeds[runIndex % seedCount];
+
+    run.configuration = runIndex / seedCount;
+    run.valueIndex.assign(mSweep.axes.size(), 0);
+    size_t remainder = run.configuration;
+    for (size_t axis = mSweep.axes.size(); axis-- > 0;) {
+        const SweepAxis& sweepAxis = mSweep.axes[axis];
+        run.valueIndex[axis] = remainder % sweepAxis.values.size();
+        remainder /= sweepAxis.values.size();
+        SweepDescription::ApplyValue(sweepAxis.key, sweepAxis.values[run.valueIndex[axis]], config);
+    }
+    return config;
+}
+
+// 🚀 EXÉCUTION DE L'ENSEMBLE
+void EnsembleRunner::Run(int threadCount) {
+    const size_t runCount = mSweep.GetRunCount();
+    mResults.assign(runCount, RunResult{});
+    JobSystem jobs(threadCount);
+    ECO_LOG_INFO("🧬 Ensemble: " << runCount << " exécutions (" << mSweep.GetConfigurationCount()
+                 << " configurations), " << jobs.GetThreadCount() << " à la fois");
+
+    auto start = std::chrono::steady_clock::now();
+    // Une tranche par exécution : les plus longues n'immobilisent pas un lot entier
+    jobs.ParallelFor(runCount, 1, [this, runCount](size_t runIndex, size_t, size_t) {
+        RunResult& run = mResults[runIndex];
+        HeadlessRunner runner(MakeConfig(runIndex, run));
+        run.seed = runner.GetEcosystem().GetSeed();
+        run.result = runner.Run();
+        ECO_LOG_INFO("   Exécution " << runIndex + 1 << "/" << runCount << " (graine " << run.seed << "): "
+                     << run.result.ticks << " ticks en " << run.result.wallSeconds << " s");
+    });
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    mWallSeconds = elapsed.count();
+}
+
+// 📄 TABLE CSV
+bool EnsembleRunner::WriteTable(const std::string& path) const {
+    FILE* out = path.empty() ? stdout : std::fopen(path.c_str(), "w");
+    if (!out) return false;
+
+    std::fprintf(out, "run,configuration,seed");
+    for (const SweepAxis& axis : mSweep.axes) std::fprintf(out, ",%s", axis.key.c_str());
+    std::fprintf(out, ",ticks_simulated,final_herbivores,final_carnivores,final_plants,final_food,final_entities,births,deaths,day,"
+                      "herbivore_extinction_tick,carnivore_extinction_tick,min_population,max_population,"
+                      "wall_seconds,ticks_per_second\n");
+
+    for (size_t i = 0; i < mResults.size(); ++i) {
+        const RunResult& run = mResults[i];
+        const HeadlessRunner::Result& result = run.result;
+        const Ecosystem::Statistics& stats = result.finalStatistics;
+        std::fprintf(out, "%zu,%zu,%" PRIu64, i, run.configuration, run.seed);
+        for (size_t axis = 0; axis < mSweep.axes.size(); ++axis) {
+            std::fprintf(out, ",%s", mSweep.axes[axis].values[run.valueIndex[axis]].c_str());
+        }
+        std::fprintf(out, ",%lld,%d,%d,%d,%d,%d,%d,%d,%d,%lld,%lld,%d,%d,%.6f,%.1f\n",
+                     result.ticks, stats.totalHerbivores, stats.totalCarnivores, stats.totalPlants,
+                     stats.totalFood, result.finalEntityCount, stats.totalBirths, stats.totalDeaths, stats.day,
+                     result.herbivoreExtinctionTick, result.carnivoreExtinctionTick,
+                     result.minimumPopulation, result.maximumPopulation,
+                     result.wallSeconds, result.ticksPerSecond);
+    }
+
+    if (out == stdout) {
+        std::fflush(out);
+        return true;
+    }
+    return std::fclose(out) == 0;
+}
+
+// 📊 RÉSUMÉ : débit global, puis moyennes par configuration
+void EnsembleRunner::PrintSummary() const {
+    long long totalTicks = 0;
+    double runSeconds = 0.0;
+    for (const RunResult& run : mResults) {
+        totalTicks += run.result.ticks;
+        runSeconds += run.result.wallSeconds;
+    }
+
+    Logger::Instance().Flush();
+    std::cout << "📊 Ensemble terminé: " << mResults.size() << " exécutions en " << mWallSeconds << " s" << std::endl;
+    std::cout << "   Débit: " << (mWallSeconds > 0.0 ? totalTicks / mWallSeconds : 0.0) << " ticks/s au total, "
+              << (mWallSeconds > 0.0 ? runSeconds / mWallSeconds : 0.0) << " mondes actifs en moyenne" << std::endl;
+
+    const size_t seedCount = mSweep.seeds.empty() ? 1 : mSweep.seeds.size();
+    for (size_t configuration = 0; configuration * seedCount < mResults.size(); ++configuration) {
+        double herbivores = 0.0;
+        double carnivores = 0.0;
+        double plants = 0.0;
+        int herbivoreExtinctions = 0;
+        int carnivoreExtinctions = 0;
+        const RunResult& first = mResults[configuration * seedCount];
+        for (size_t seed = 0; seed < seedCount; ++seed) {
+            const HeadlessRunner::Result& result = mResults[configuration * seedCount + seed].result;
+            herbivores += result.finalStatistics.totalHerbivores;
+            carnivores += result.finalStatistics.totalCarnivores;
+            plants += result.finalStatistics.totalPlants;
+            herbivoreExtinctions += result.herbivoreExtinctionTick >= 0;
+            carnivoreExtinctions += result.carnivoreExtinctionTick >= 0;
+        }
+
+        std::cout << "   [" << configuration << "]";
+        for (size_t axis = 0; axis < mSweep.axes.size(); ++axis) {
+            std::cout << " " << mSweep.axes[axis].key << "=" << mSweep.axes[axis].values[first.valueIndex[axis]];
+        }
+        std::cout << " - Herbivores: " << herbivores / seedCount
+                  << ", Carnivores: " << carnivores / seedCount
+                  << ", Plantes: " << plants / seedCount
+                  << " (moyennes sur " << seedCount << " graine(s)), extinctions H/C: "
+                  << herbivoreExtinctions << "/" << carnivoreExtinctions << std::endl;
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -1,166 +1,114 @@
 #include "Core/Entity.h" 
 #include <cmath> 
-#include <iostream> 
+#include "Core/LifeCycleKernels.h" 
+#include "Core/Logger.h" 
 #include <algorithm> 
-#include <SDL3/SDL.h>
 
 namespace Ecosystem { 
 namespace Core { 
 
-// 🏗 CONSTRUCTEUR PRINCIPAL 
-Entity::Entity( EntityType type, Vector2D pos, std::string entityName) 
-    : mType( type), position( pos), name( entityName),  
-      mRandomGenerator( std::random_device{}())  // Initialisation du générateur alé
- { 
-
-    // INITIALISATION SELON LE TYPE 
-    switch( mType) { 
-        case EntityType::HERBIVORE: 
-            mEnergy = 80.0f; 
-            mMaxEnergy = 150.0f; 
-            mMaxAge = 200; 
-            color = Color::Blue(); 
-            size = 8.0f; 
-            break; 
-
-        case EntityType::CARNIVORE: 
-            mEnergy = 100.0f; 
-            mMaxEnergy = 200.0f; 
-            mMaxAge = 150; 
-            color = Color::Red(); 
-            size = 12.0f; 
-            break; 
-
-        case EntityType::PLANT: 
-            mEnergy = 50.0f; 
-            mMaxEnergy = 100.0f; 
-            mMaxAge = 300; 
-            color = Color::Green(); 
-            size = 6.0f; 
-            break; 
-    }
-
-    mAge = 0; 
-    mIsAlive = true; 
-    mVelocity = GenerateRandomDirection(); 
+// 🏗 CRÉATION (ancien constructeur principal) 
+// Valeurs initiales selon le type : table des espèces de l'écosystème 
+Entity Entity::Create( EntityStore& store, EntityType type, Vector2D pos, CounterRandom& random, 
+                       const SpeciesParameters& parameters) 
+{ 
+    size_t index = store.Add( type, pos, GenerateRandomDirection( random), 
+                              parameters.initialEnergy, parameters.maxEnergy, parameters.maxAge, 
+                              parameters.size, parameters.color); 
 
-    std::cout << "🌱Entité créée: " << name << " à (" << position.x << ", " << position.y<<")"<< std::endl;
+    ECO_LOG_DEBUG("🌱Entité créée: " << EntityName( type, store.id[index]).GetText() << " à (" << pos.x << ", " << pos.y << ")");
+    return Entity( store, index); 
  } 
 
-// 🏗 CONSTRUCTEUR DE COPIE 
-Entity::Entity(const Entity& other) 
-    : mType(other.mType), position(other.position), name(other.name + "_copy"), 
-      mEnergy(other.mEnergy * 0.7f),  // Enfant a moins d'énergie 
-      mMaxEnergy(other.mMaxEnergy), 
-      mAge(0),  // Nouvelle entité, âge remis à 0 
-      mMaxAge(other.mMaxAge), 
-      mIsAlive(true), 
-      mVelocity(other.mVelocity), 
-      color(other.color), 
-      size(other.size * 0.8f),  // Enfant plus petit 
-      mRandomGenerator(std::random_device{}()) 
+// 🏗 CRÉATION D'UN ENFANT (ancien constructeur de copie) 
+Entity Entity::CreateOffspring( EntityStore& store, size_t parentIndex) 
 { 
-    std::cout << "👶Copie d'entité créée: " << name << std::endl; 
+    // Copies locales : Add() peut réallouer les tableaux du parent 
+    Vector2D position = store.GetPosition( parentIndex); 
+    Vector2D velocity( store.velocityX[parentIndex], store.velocityY[parentIndex]); 
+    store.energy[parentIndex] *= 0.6f;  // Coût énergétique de la reproduction 
+
+    size_t index = store.Add( store.type[parentIndex], position, velocity, 
+                              store.energy[parentIndex] * 0.7f,  // Enfant a moins d'énergie 
+                              store.maxEnergy[parentIndex], 
+                              store.maxAge[parentIndex], 
+                              store.size[parentIndex] * 0.8f,    // Enfant plus petit 
+                              store.color[parentIndex], 
+                              store.id[parentIndex]); 
+
+    ECO_LOG_DEBUG("👶Naissance: " << Entity( store, index).GetName().GetText() 
+                  << " (parent " << Entity( store, parentIndex).GetName().GetText() << ")"); 
+    return Entity( store, index); 
 } 
-    
-// 🗑 DESTRUCTEUR 
-Entity::~Entity() { 
-    std::cout << "💀Entité détruite: " << name << " (Âge: " << mAge << ")" << std::endl; 
- } 
 
-//⚙MISE À JOUR PRINCIPALE 
-void Entity::Update(float deltaTime) { 
-    if ( !mIsAlive) return; 
+// 💀 MORT (appliquée à la fusion des commandes, dans un ordre fixe) 
+void Entity::ApplyDeath( EntityStore& store, const LifeCycleCommands::Death& death) { 
+    store.Kill( death.index); 
+    ECO_LOG_DEBUG("💀" << Entity( store, death.index).GetName().GetText() << " meurt - " << ( death.starvation ? "Faim" : "Vieillesse")); 
+} 
 
-    // PROCESSUS DE VIE 
-    ConsumeEnergy(deltaTime); 
-    Age( deltaTime); 
-    Move( deltaTime); 
-    CheckVitality(); 
+//⚙MISE À JOUR PRINCIPALE : une passe par processus de vie 
+void Entity::UpdateRange( EntityStore& store, size_t begin, size_t end, float deltaTime, 
+                          const SpeciesTable& species, uint64_t worldSeed, uint32_t tick, 
+                          LifeCycleCommands& commands) { 
+    // PROCESSUS DE VIE (noyaux vectorisés, sauf les tirages aléatoires) 
+    LifeCycleKernels::ConsumeEnergy( store, begin, end, deltaTime, species.GetEnergyDrain()); 
+    LifeCycleKernels::Age( store, begin, end, deltaTime); 
+    Move( store, begin, end, deltaTime, worldSeed, tick); 
+    LifeCycleKernels::CollectDeaths( store, begin, end, commands); 
 } 
 
 // MOUVEMENT 
-void Entity::Move(float deltaTime) { 
-    if ( mType == EntityType::PLANT) return;  // Les plantes ne bougent pas 
-    // Comportement aléatoire occasionnel 
-    std::uniform_real_distribution<float> chance( 0.0f, 1.0f); 
-    if ( chance(mRandomGenerator) < 0.02f) { 
-        mVelocity = GenerateRandomDirection(); 
+void Entity::Move( EntityStore& store, size_t begin, size_t end, float deltaTime, uint64_t worldSeed, uint32_t tick) { 
+    for ( size_t i = begin; i < end; ++i) { 
+        if ( !store.alive[i] || !LifeCycleKernels::IsMobile[static_cast<size_t>( store.type[i])]) continue;  // Les plantes ne bougent pas 
+        // Comportement aléatoire occasionnel (flux propre à l'entité et au tick) 
+        CounterRandom random( worldSeed, store.id[i], tick, RandomStream::Movement); 
+        if ( random.NextFloat() < 0.02f) { 
+            Vector2D direction = GenerateRandomDirection( random); 
+            store.velocityX[i] = direction.x; 
+            store.velocityY[i] = direction.y; 
+        }
     }
-    // Application du mouvement 
-    position = position + mVelocity * deltaTime * 20.0f; 
-    // Consommation d'énergie due au mouvement 
-    mEnergy -= mVelocity.Distance( Vector2D( 0, 0)) * deltaTime * 0.1f; 
+    // Application du mouvement et de son coût en énergie 
+    LifeCycleKernels::Integrate( store, begin, end, deltaTime); 
 } 
 
 // 🍽 MANGER
  void Entity::Eat( float energy) 
  { 
-    mEnergy += energy; 
-    if ( mEnergy > mMaxEnergy) { 
-         mEnergy = mMaxEnergy; 
+    float& current = mStore->energy[mIndex]; 
+    current += energy; 
+    if ( current > mStore->maxEnergy[mIndex]) { 
+         current = mStore->maxEnergy[mIndex]; 
     } 
-       std::cout << "🍽 " << name << " mange et gagne " << energy << " énergie" << std::endl;
+       ECO_LOG_TRACE("🍽 " << GetName().GetText() << " mange et gagne " << energy << " énergie");
     }
     
- // CONSOMMATION D'ÉNERGIE 
-void Entity::ConsumeEnergy(float deltaTime) { 
-    float baseConsumption = 0.0f; 
-    switch( mType) { 
-        case EntityType::HERBIVORE: 
-            baseConsumption = 1.5f; 
-            break; 
-        case EntityType::CARNIVORE: 
-            baseConsumption = 2.0f; 
-            break; 
-        case EntityType::PLANT: 
-            baseConsumption = -0.5f;  // Les plantes génèrent de l'énergie ! 
-            break; 
-    }
-    mEnergy -= baseConsumption * deltaTime; 
-
-} 
-// VIEILLISSEMENT 
-void Entity::Age( float deltaTime) { 
-    mAge += static_cast<int>( deltaTime * 10.0f);  // Accéléré pour la simulation 
-} 
-
-// ❤VÉRIFICATION DE LA SANTÉ 
-void Entity::CheckVitality() { 
-    if ( mEnergy <= 0.0f || mAge >= mMaxAge) { 
-        mIsAlive = false; 
-        std::cout << "💀" << name << " meurt - "; 
-        if ( mEnergy <= 0) std::cout << "Faim"; 
-        else std::cout << "Vieillesse"; 
-        std::cout << std::endl; 
-    }
- } 
 
 // REPRODUCTION 
 bool Entity::CanReproduce() const { 
-    return mIsAlive && mEnergy > mMaxEnergy * 0.8f && mAge > 20; 
+    return IsAlive() && GetEnergy() > mStore->maxEnergy[mIndex] * 0.8f && GetAge() > 20.0f; 
 } 
-std::unique_ptr<Entity> Entity::Reproduce() { 
-    if ( !CanReproduce()) return nullptr; 
+bool Entity::Reproduce( uint64_t worldSeed, uint32_t tick) const { 
+    if ( !CanReproduce()) return false; 
     // Chance de reproduction 
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f); 
-    if ( chance(mRandomGenerator) < 0.3f) { 
-    }
-        mEnergy *= 0.6f;  // Coût énergétique de la reproduction 
-        return std::make_unique<Entity>( *this);  // Utilise le constructeur de copi
-    return nullptr; 
+    CounterRandom random( worldSeed, mStore->id[mIndex], tick, RandomStream::Reproduction); 
+    return random.NextFloat() < 0.3f; 
 } 
 
 // GÉNÉRATION DE DIRECTION ALÉATOIRE 
-Vector2D Entity::GenerateRandomDirection() { 
-    std::uniform_real_distribution<float> dist( -1.0f, 1.0f); 
-    return Vector2D( dist( mRandomGenerator), dist(mRandomGenerator)); 
+Vector2D Entity::GenerateRandomDirection( CounterRandom& random) { 
+    float x = random.NextFloat( -1.0f, 1.0f); 
+    float y = random.NextFloat( -1.0f, 1.0f); 
+    return Vector2D( x, y); 
 } 
 
 // CALCUL DE LA COULEUR BASÉE SUR L'ÉTAT 
-Color Entity::CalculateColorBasedOnState() const { 
-    float energyRatio = GetEnergyPercentage(); 
-    Color baseColor = color; 
+Color Entity::CalculateColorBasedOnState( const EntityStore& store, size_t index) { 
+    return CalculateColorBasedOnState( store.color[index], store.energy[index] / store.maxEnergy[index]); 
+} 
+Color Entity::CalculateColorBasedOnState( Color baseColor, float energyRatio) { 
     // Rouge si faible énergie 
     if ( energyRatio < 0.3f) { 
         baseColor.r = 255; 
@@ -169,55 +117,11 @@ Color Entity::CalculateColorBasedOnState() const {
     }
     return baseColor; 
 } 
-//RENDU GRAPHIQUE 
-void Entity::Render( SDL_Renderer* renderer) const { 
-    if ( !mIsAlive) return; 
-    Color renderColor = CalculateColorBasedOnState(); 
-
-    SDL_FRect rect = { 
-        position.x - size / 2.0f, 
-        position.y - size / 2.0f, 
-        size, 
-        size 
-    }; 
-
-    SDL_SetRenderDrawColor( renderer, renderColor.r, renderColor.g, renderColor.b, renderColor.a);
-    SDL_RenderFillRect( renderer, &rect); 
-    
-    // Indicateur d'énergie (barre de vie) 
-    if ( mType != EntityType::PLANT) { 
-        float energyBarWidth = size * GetEnergyPercentage(); 
-        SDL_FRect energyBar = { 
-            position.x - size / 2.0f, 
-            position.y - size / 2.0f - 3.0f, 
-            energyBarWidth, 
-            2.0f 
-        };
-        SDL_SetRenderDrawColor( renderer, 0, 255, 0, 255); 
-        SDL_RenderFillRect( renderer, &energyBar); 
-    }
- } 
-
-// implémentation de la fonction pour la gestion de la fonction de silulation
-// Cette fonction permet de modifier la vélocvité inetrne de l'entité
-
-//APllication une force physique à l'entite (simulation de movement)
-void Entity::ApplyForce(vector2D ApplyForce) { 
-    //addition vevctoriel de la force à la velocité actuelle
-    mVelocity = mVelocity + force;  
-    float maxpSped = ( mType == Entitype::CARNIVORE) ? 120.0f : 80.0f;
-    float currebtSpeed = mVelocity.Length();
-
-    // Condition d'evaluation de la vitesse de déplacement: si maximum → ramener au minimum
-    if ( currentSpeed > maxSpeed) {
-        mVelocity = mVelocity * ( maxSpeed / currentSpeed);
-    } 
-}
-
 // Cette fonction permet de maintenir l'entite dans les limites du monde simule
 // Evite la disparition des entitites de l'ecran
 Vector2D Entity::StayInBounds ( float worldWidth, float worldHeight) const {
-    Vector steering ( 0.0f, 0.0f);
+    Vector2D steering ( 0.0f, 0.0f);
+    Vector2D position = GetPosition();
     float margin = 30.0f; //zone tampon avant les bord
 
     // condition detection des bords gauche et droite:
@@ -235,78 +139,6 @@ Vector2D Entity::StayInBounds ( float worldWidth, float worldHeight) const {
     return steering * 3.0f;
 }
 
-// Fonction permettant aux entite ( animaux) d'echaper aux predateur: fonction de survi
-Vector2D Entity::AvoidPredators(const std::vector<Entity>& predators) const {
-
-    // Selection ou flitrage : Seuls les herbivores ont besoin de fuir
-    // Les carnivores et plantes ne sont pas concerné!
-    if ( mType != EntityType::HERBIVORE) {
-        return Vector2D(0.0f, 0.0f);
-    }
-    
-    Vector2D avoidance(0.0f, 0.0f);
-    
-    // ANALYSE DES PRÉDATEURS : Parcours de tous les prédateurs potentiels
-    for ( const auto& predator : predators) {
-        // VÉRIFICATION : Le prédateur doit être vivant et de type carnivore
-        if ( predator.IsAlive() && predator.mType == EntityType::CARNIVORE) {
-            Vector2D toPredator = predator.position - position;
-            float distance = toPredator.Length();
-            
-            // ZONE DE DANGER : Si le prédateur est dans un rayon de 80 unités
-            if ( distance < 80.0f && distance > 0) {
-                // CALCUL DE FUITE : Direction opposée au prédateur
-                // L'intensité augmente avec la proximité
-                Vector2D fleeDirection = -toPredator.Normalized();
-                avoidance = avoidance + fleeDirection * (80.0f - distance);
-            }
-        }
-    }
-    
-    return avoidance;
-}
-
-
-// Fonction SeekFood prend en charge la recherche de nutriment pour la survie et le maintien d'energie
-
-Vector2D Entity::SeekFood(const std::vector<Food>& foodSources) const
-{
-    // EXCLUSION : Les plantes ne cherchent pas de nourriture (photosynthèse)
-    if ( mType == EntityType::PLANT) {
-        return Vector2D(0.0f, 0.0f);
-    }
-    
-    Vector2D seeking( 0.0f, 0.0f);
-    float closestDist = 1000.0f; // Distance initiale très grande
-    Vector2D bestDirection( 0.0f, 0.0f);
-    
-    // RECHERCHE DE NOURRITURE : Analyse de toutes les sources disponibles
-    for ( const auto& food : foodSources) {
-        Vector2D toFood = food.position - position;
-        float dist = toFood.Length();
-        
-        // CHAÎNE ALIMENTAIRE :
-        // - Herbivores mangent des plantes
-        // - Carnivores mangent des herbivores
-        bool isGoodFood = ( mType == EntityType::HERBIVORE && food.IsPlant()) ||
-                         ( mType == EntityType::CARNIVORE && food.IsHerbivore());
-        
-        // SÉLECTION : On garde la nourriture valide la plus proche
-        if (isGoodFood && dist < closestDist) {
-            closestDist = dist;
-            bestDirection = toFood.Normalized();
-        }
-    }
-    
-    // ACTION : Se déplacer vers la nourriture si elle est assez proche
-    if ( closestDist < 150.0f) {
-        seeking = bestDirection * 2.0f;
-    }
-    
-    return seeking;
-}
-
-
  
 } // namespace Core 
 } // namespace Ecosystem
\ No newline at end of file
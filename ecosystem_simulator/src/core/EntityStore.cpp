@@ -0,0 +1,187 @@
+#include "Core/EntityStore.h"
+#include "Core/SpeciesTraits.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <utility>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏷 NOM À LA DEMANDE
+EntityName::EntityName(EntityType type, uint64_t id) {
+    const char* typeName = GetTypeName(type);
+    const size_t length = std::min(std::strlen(typeName), MaxTypeNameLength);
+    std::memcpy(mText, typeName, length);
+    mText[length] = '_';
+    char* end = std::to_chars(mText + length + 1, mText + sizeof(mText) - 1, id).ptr;
+    *end = '\0';
+}
+
+const char* EntityName::GetTypeName(EntityType type) {
+    const size_t index = static_cast<size_t>(type);
+    return index < SpeciesCount ? SpeciesNames[index] : "Entity";
+}
+
+// ➕ AJOUT D'UNE ENTITÉ : nouvel ID, âge nul
+size_t EntityStore::Add(EntityType entityType, Vector2D position, Vector2D velocity,
+                        float initialEnergy, float maximumEnergy, float maximumAge,
+                        float entitySize, Color entityColor, uint64_t parent) {
+    return Place(entityType, position, velocity, initialEnergy, maximumEnergy, 0.0f, maximumAge,
+                 entitySize, entityColor, mNextId++, parent);
+}
+
+// 📥 RÉINSERTION D'UNE ENTITÉ MIGRANTE (ID et âge conservés, position de départ = position)
+size_t EntityStore::Insert(const EntityRecord& record) {
+    return Place(record.type, Vector2D(record.positionX, record.positionY),
+                 Vector2D(record.velocityX, record.velocityY), record.energy, record.maxEnergy,
+                 record.age, record.maxAge, record.size, record.color, record.id, record.parentId);
+}
+
+// 📤 COPIE COMPLÈTE D'UNE ENTITÉ
+EntityRecord EntityStore::Extract(size_t index) const {
+    EntityRecord record{};
+    record.positionX = positionX[index];
+    record.positionY = positionY[index];
+    record.velocityX = velocityX[index];
+    record.velocityY = velocityY[index];
+    record.energy = energy[index];
+    record.maxEnergy = maxEnergy[index];
+    record.age = age[index];
+    record.maxAge = maxAge[index];
+    record.size = size[index];
+    record.color = color[index];
+    record.type = type[index];
+    record.id = id[index];
+    record.parentId = parentId[index];
+    return record;
+}
+
+// 📍 OCCUPATION D'UNE CASE : case libre si possible, sinon en fin de tableaux
+size_t EntityStore::Place(EntityType entityType, Vector2D position, Vector2D velocity, float initialEnergy,
+                          float maximumEnergy, float initialAge, float maximumAge, float entitySize,
+                          Color entityColor, uint64_t entityId, uint64_t parent) {
+    if (!mFreeSlots.empty()) {
+        size_t index = mFreeSlots.back();
+        mFreeSlots.pop_back();
+        positionX[index] = position.x;
+        positionY[index] = position.y;
+        previousPositionX[index] = position.x;
+        previousPositionY[index] = position.y;
+        velocityX[index] = velocity.x;
+        velocityY[index] = velocity.y;
+        energy[index] = initialEnergy;
+        maxEnergy[index] = maximumEnergy;
+        age[index] = initialAge;
+        maxAge[index] = maximumAge;
+        type[index] = entityType;
+        alive[index] = 1;
+        id[index] = entityId;
+        size[index] = entitySize;
+        color[index] = entityColor;
+        parentId[index] = parent;
+        ++mLiveByType[static_cast<size_t>(entityType)];
+        return index;
+    }
+
+    positionX.push_back(position.x);
+    positionY.push_back(position.y);
+    previousPositionX.push_back(position.x);
+    previousPositionY.push_back(position.y);
+    velocityX.push_back(velocity.x);
+    velocityY.push_back(velocity.y);
+    energy.push_back(initialEnergy);
+    maxEnergy.push_back(maximumEnergy);
+    age.push_back(initialAge);
+    maxAge.push_back(maximumAge);
+    type.push_back(entityType);
+    alive.push_back(1);
+    id.push_back(entityId);
+    size.push_back(entitySize);
+    color.push_back(entityColor);
+    parentId.push_back(parent);
+    ++mLiveByType[static_cast<size_t>(entityType)];
+    return type.size() - 1;
+}
+
+// 💀 MORT : la case reste occupée jusqu'à la fin du tick
+void EntityStore::Kill(size_t index) {
+    if (!alive[index]) return;
+    alive[index] = 0;
+    mPendingDeaths.push_back(index);
+    --mLiveByType[static_cast<size_t>(type[index])];
+}
+
+// ♻ RECYCLAGE : les cases des morts du tick rejoignent la liste libre
+size_t EntityStore::RecycleDead() {
+    const size_t recycled = mPendingDeaths.size();
+    mFreeSlots.insert(mFreeSlots.end(), mPendingDeaths.begin(), mPendingDeaths.end());
+    mPendingDeaths.clear();
+    return recycled;
+}
+
+// 📍 MÉMORISATION DES POSITIONS AVANT UN PAS DE SIMULATION
+void EntityStore::SavePreviousPositions() {
+    previousPositionX = positionX;  // Même taille : simple copie, sans réallocation
+    previousPositionY = positionY;
+}
+
+// 💾 RESTAURATION DE LA COMPTABILITÉ (colonnes déjà chargées)
+void EntityStore::RestoreSlots(uint64_t nextId, std::vector<size_t> freeSlots, std::vector<size_t> pendingDeaths) {
+    mNextId = nextId;
+    mFreeSlots = std::move(freeSlots);
+    mPendingDeaths = std::move(pendingDeaths);
+    mLiveByType.fill(0);
+    for (size_t i = 0; i < type.size(); ++i) {
+        mLiveByType[static_cast<size_t>(type[i])] += alive[i] != 0;
+    }
+}
+
+// 📦 RÉSERVATION
+void EntityStore::Reserve(size_t capacity) {
+    positionX.reserve(capacity);
+    positionY.reserve(capacity);
+    previousPositionX.reserve(capacity);
+    previousPositionY.reserve(capacity);
+    velocityX.reserve(capacity);
+    velocityY.reserve(capacity);
+    energy.reserve(capacity);
+    maxEnergy.reserve(capacity);
+    age.reserve(capacity);
+    maxAge.reserve(capacity);
+    type.reserve(capacity);
+    alive.reserve(capacity);
+    id.reserve(capacity);
+    size.reserve(capacity);
+    color.reserve(capacity);
+    parentId.reserve(capacity);
+    mFreeSlots.reserve(capacity);
+    mPendingDeaths.reserve(capacity);
+}
+
+// 🗑 VIDAGE
+void EntityStore::Clear() {
+    positionX.clear();
+    positionY.clear();
+    previousPositionX.clear();
+    previousPositionY.clear();
+    velocityX.clear();
+    velocityY.clear();
+    energy.clear();
+    maxEnergy.clear();
+    age.clear();
+    maxAge.clear();
+    type.clear();
+    alive.clear();
+    id.clear();
+    size.clear();
+    color.clear();
+    parentId.clear();
+    mFreeSlots.clear();
+    mPendingDeaths.clear();
+    mLiveByType.fill(0);
+    mNextId = 0;
+}
+
+} // namespace Core
+} // namespace Ecosystem
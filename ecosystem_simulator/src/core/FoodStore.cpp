@@ -0,0 +1,154 @@
+#include "Core/FoodStore.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+FoodStore::FoodStore(float worldWidth, float worldHeight, float cellSize)
+    : mCellSize(cellSize), mInverseCellSize(1.0f / cellSize), mColumns(1), mRows(1)
+{
+    Resize(worldWidth, worldHeight, cellSize);
+}
+
+// 📐 DIMENSIONNEMENT DE LA GRILLE (les éléments présents sont réindexés)
+void FoodStore::Resize(float worldWidth, float worldHeight, float cellSize) {
+    mCellSize = cellSize;
+    mInverseCellSize = 1.0f / cellSize;
+    mColumns = std::max(1, static_cast<int>(std::ceil(worldWidth * mInverseCellSize)));
+    mRows = std::max(1, static_cast<int>(std::ceil(worldHeight * mInverseCellSize)));
+
+    for (auto& cell : mCells) cell.clear();
+    mCells.resize(static_cast<size_t>(mColumns) * mRows);
+    // Ordre dense : le contenu des cellules ne dépend pas de l'ancienne grille
+    for (size_t i = 0; i < mItems.size(); ++i) {
+        IndexSlot(mDenseSlot[i], mItems[i].position);
+    }
+}
+
+// 🧹 VIDAGE (générations conservées : les anciennes poignées restent invalides)
+void FoodStore::Clear() {
+    for (uint32_t slot : mDenseSlot) {
+        mSlots[slot].dense = FreeSlot;
+        if (++mSlots[slot].generation == 0) mSlots[slot].generation = 1;
+    }
+    mItems.clear();
+    mDenseSlot.clear();
+    for (auto& cell : mCells) cell.clear();
+    // Cases rendues dans l'ordre croissant : la plus basse est réoccupée en premier
+    mFreeSlots.clear();
+    for (uint32_t slot = static_cast<uint32_t>(mSlots.size()); slot-- > 0;) {
+        mFreeSlots.push_back(slot);
+    }
+}
+
+void FoodStore::Reserve(size_t capacity) {
+    mItems.reserve(capacity);
+    mDenseSlot.reserve(capacity);
+    mSlots.reserve(capacity);
+    mFreeSlots.reserve(capacity);
+}
+
+// ➕ AJOUT EN O(1)
+FoodHandle FoodStore::Add(const Food& food) {
+    uint32_t slot;
+    if (!mFreeSlots.empty()) {
+        slot = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(mSlots.size());
+        mSlots.push_back({1, FreeSlot, 0, 0});
+    }
+
+    mSlots[slot].dense = static_cast<uint32_t>(mItems.size());
+    mItems.push_back(food);
+    mDenseSlot.push_back(slot);
+    IndexSlot(slot, food.position);
+    return {slot, mSlots[slot].generation};
+}
+
+// ➖ RETRAIT EN O(1) : le dernier élément dense et la dernière entrée de la cellule comblent les trous
+bool FoodStore::Remove(FoodHandle handle) {
+    if (!IsValid(handle)) return false;
+    Slot& removed = mSlots[handle.slot];
+
+    // 1. Cellule
+    std::vector<CellEntry>& cell = mCells[removed.cell];
+    const CellEntry& lastEntry = cell.back();
+    if (removed.cellPosition + 1 != cell.size()) {
+        mSlots[lastEntry.slot].cellPosition = removed.cellPosition;
+        cell[removed.cellPosition] = lastEntry;
+    }
+    cell.pop_back();
+
+    // 2. Tableau dense
+    const uint32_t dense = removed.dense;
+    const uint32_t last = static_cast<uint32_t>(mItems.size() - 1);
+    if (dense != last) {
+        mItems[dense] = mItems[last];
+        mDenseSlot[dense] = mDenseSlot[last];
+        mSlots[mDenseSlot[dense]].dense = dense;
+    }
+    mItems.pop_back();
+    mDenseSlot.pop_back();
+
+    // 3. Case libérée, génération suivante (0 réservé à la poignée vide)
+    removed.dense = FreeSlot;
+    if (++removed.generation == 0) removed.generation = 1;
+    mFreeSlots.push_back(handle.slot);
+    return true;
+}
+
+// 🔢 COORDONNÉES DE CELLULE (les positions hors du monde sont ramenées au bord)
+int FoodStore::CellX(float x) const {
+    const int cell = static_cast<int>(std::floor(x * mInverseCellSize));
+    return std::clamp(cell, 0, mColumns - 1);
+}
+
+int FoodStore::CellY(float y) const {
+    const int cell = static_cast<int>(std::floor(y * mInverseCellSize));
+    return std::clamp(cell, 0, mRows - 1);
+}
+
+void FoodStore::IndexSlot(uint32_t slot, Vector2D position) {
+    const uint32_t cell = static_cast<uint32_t>(CellY(position.y) * mColumns + CellX(position.x));
+    mSlots[slot].cell = cell;
+    mSlots[slot].cellPosition = static_cast<uint32_t>(mCells[cell].size());
+    mCells[cell].push_back({position, slot});
+}
+
+// 🎯 PLUS PROCHE ÉLÉMENT DANS LE RAYON
+FoodHandle FoodStore::FindNearest(Vector2D center, float radius) const {
+    if (mItems.empty()) return {};
+
+    const float radiusSquared = radius * radius;
+    const int minX = CellX(center.x - radius);
+    const int maxX = CellX(center.x + radius);
+    const int minY = CellY(center.y - radius);
+    const int maxY = CellY(center.y + radius);
+
+    uint32_t bestSlot = FreeSlot;
+    float bestDistanceSquared = radiusSquared;
+    for (int cy = minY; cy <= maxY; ++cy) {
+        for (int cx = minX; cx <= maxX; ++cx) {
+            for (const CellEntry& entry : mCells[cy * mColumns + cx]) {
+                const float distanceSquared = (entry.position - center).LengthSquared();
+                // Égalité départagée par l'indice dense pour rester déterministe (l'ordre dans
+                // les cellules dépend de l'historique des cases) ; lu seulement en cas d'égalité
+                if (distanceSquared < bestDistanceSquared ||
+                    (bestSlot != FreeSlot && distanceSquared == bestDistanceSquared &&
+                     mSlots[entry.slot].dense < mSlots[bestSlot].dense)) {
+                    bestSlot = entry.slot;
+                    bestDistanceSquared = distanceSquared;
+                }
+            }
+        }
+    }
+
+    if (bestSlot == FreeSlot) return {};
+    return {bestSlot, mSlots[bestSlot].generation};
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -1,61 +1,330 @@
 #include "Core/GameEngine.h"
-#include <iostream>
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
 namespace Ecosystem {
 namespace Core {
 
 // 🏗 CONSTRUCTEUR
-GameEngine::GameEngine(const std::string& title, float width, float height)
-    : mWindow(title, width, height), 
-      mEcosystem(width, height, 500),
+GameEngine::GameEngine(const std::string& title, float windowWidth, float windowHeight,
+                       float worldWidth, float worldHeight)
+    : mWindow(title, windowWidth, windowHeight), 
+      mCamera(windowWidth, windowHeight),
+      mEcosystem(worldWidth > 0.0f ? worldWidth : windowWidth,
+                 worldHeight > 0.0f ? worldHeight : windowHeight, 500, 0),
       mIsRunning(false), 
       mIsPaused(false),
       mTimeScale(1.0f),
-      mAccumulatedTime(0.0f) {}
+      mShowProfiler(false),
+      mPendingRenderNs(0),
+      mViewMinX(0.0f),
+      mViewMinY(0.0f),
+      mViewMaxX(0.0f),
+      mViewMaxY(0.0f),
+      mFramesReceived(0),
+      mDuplicatedFrames(0),
+      mCameraWorldWidth(0.0f),
+      mCameraWorldHeight(0.0f),
+      mAccumulatedTime(0.0f),
+      mMaxSubstepsPerFrame(16),
+      mSubstepsLastFrame(0),
+      mAverageSubsteps(0.0f),
+      mDroppedSimulationTime(0.0f),
+      mReadoutTimer(0.0f),
+      mStatsTimer(0.0f),
+      mSnapshotPath("ecosystem.snapshot") {}
 
 // ⚙️ INITIALISATION
 bool GameEngine::Initialize() {
     if (!mWindow.Initialize()) {
         return false;
     }
+    mRenderer.Initialize(mWindow.GetRenderer());
+    mCameraWorldWidth = mEcosystem.GetWorldWidth();
+    mCameraWorldHeight = mEcosystem.GetWorldHeight();
+    mCamera.FitWorld(mCameraWorldWidth, mCameraWorldHeight);
+    PublishView();
     
-    mEcosystem.Initialize(20, 5, 30);  // 20 herbivores, 5 carnivores, 30 plantes
+    ResetWorld();
     mIsRunning = true;
-    mLastUpdateTime = std::chrono::high_resolution_clock::now();
     
-    std::cout << "✅ Moteur de jeu initialisé" << std::endl;
+    ECO_LOG_INFO("✅ Moteur de jeu initialisé");
     return true;
 }
 
-// 🎮 BOUCLE PRINCIPALE
+// 🎮 BOUCLE PRINCIPALE (thread de rendu)
+// Dessine la dernière image publiée, à son propre rythme : une simulation lente
+// ne bloque pas l'affichage, un rendu lent ne retarde pas les ticks.
 void GameEngine::Run() {
-    std::cout << "🎯 Démarrage de la boucle de jeu..." << std::endl;
-    
-    while (mIsRunning) {
+    ECO_LOG_INFO("🎯 Démarrage de la boucle de jeu...");
+    mSimulationThread = std::thread(&GameEngine::SimulationLoop, this);
+
+    auto lastFrameTime = std::chrono::steady_clock::now();
+    while (mIsRunning.load(std::memory_order_acquire)) {
+        const auto currentTime = std::chrono::steady_clock::now();
+        const float frameTime = std::chrono::duration<float>(currentTime - lastFrameTime).count();
+        lastFrameTime = currentTime;
+
+        HandleEvents();
+        PublishView();
+
+        if (mFrames.Acquire()) {
+            ++mFramesReceived;
+        } else if (mFramesReceived > 0) {
+            ++mDuplicatedFrames;
+        }
+        const RenderFrame& frame = mFrames.GetReadBuffer();
+
+        if (mFramesReceived > 0) {
+            // Monde rechargé d'une autre taille : la caméra suit
+            if (frame.worldWidth != mCameraWorldWidth || frame.worldHeight != mCameraWorldHeight) {
+                mCameraWorldWidth = frame.worldWidth;
+                mCameraWorldHeight = frame.worldHeight;
+                mCamera.FitWorld(mCameraWorldWidth, mCameraWorldHeight);
+            }
+
+            // Fraction du pas écoulée depuis le dernier tick de l'image : position interpolée
+            float pending = frame.pendingTime;
+            if (!frame.paused) {
+                pending += std::chrono::duration<float>(currentTime - frame.publishedAt).count() * frame.timeScale;
+            }
+            Render(frame, std::min(pending / FixedTimeStep, 1.0f));
+
+            // Lecture « ticks par image » et coût du rendu dans le titre, deux fois par seconde
+            mReadoutTimer += std::min(frameTime, MaxFrameTime);
+            if (mReadoutTimer >= 0.5f) {
+                UpdateTitle(frame);
+                mReadoutTimer = 0.0f;
+            }
+        }
+        
+        // Limitation à ~60 FPS
+        SDL_Delay(16);
+    }
+
+    if (mSimulationThread.joinable()) {
+        mSimulationThread.join();
+    }
+    ECO_LOG_INFO("🖼 Images: " << mFramesReceived << " reçues, " << mFrames.GetDroppedFrames() 
+              << " perdues, " << mDuplicatedFrames << " dupliquées");
+}
+
+// 🧮 BOUCLE DE SIMULATION (thread dédié)
+// Ticks à pas fixe selon le temps réel, puis une image publiée par série de
+// ticks ; entre deux séries, attente jusqu'au prochain pas dû.
+void GameEngine::SimulationLoop() {
+    mLastUpdateTime = std::chrono::high_resolution_clock::now();
+    PublishFrame();
+
+    while (mIsRunning.load(std::memory_order_acquire)) {
+        const bool commandsApplied = ApplyCommands();
+
         auto currentTime = std::chrono::high_resolution_clock::now();
         std::chrono::duration<float> elapsed = currentTime - mLastUpdateTime;
         mLastUpdateTime = currentTime;
         
-        float deltaTime = elapsed.count();
-        
-        HandleEvents();
+        // Une longue pause (débogueur, déplacement de fenêtre) ne doit pas provoquer de rattrapage
+        float frameTime = std::min(elapsed.count(), MaxFrameTime);
         
         if (!mIsPaused) {
-            Update(deltaTime * mTimeScale);
+            mSubstepsLastFrame = RunFixedSteps(frameTime * mTimeScale);
+        } else {
+            mSubstepsLastFrame = 0;
+        }
+        if (mSubstepsLastFrame > 0) {
+            mAverageSubsteps += (mSubstepsLastFrame - mAverageSubsteps) * 0.1f;
+        }
+
+        // Aussi quand la caméra sort de la zone copiée (déplacement en pause, zoom arrière)
+        if (mSubstepsLastFrame > 0 || commandsApplied || !mCapturedRegion.Contains(GetRequestedRegion())) {
+            PublishFrame();
+        }
+
+        // Jusqu'au prochain pas (en pause : scrutation des commandes)
+        const float wait = mIsPaused ? PausedPollInterval : (FixedTimeStep - mAccumulatedTime) / mTimeScale;
+        if (wait > 0.0f) {
+            std::this_thread::sleep_for(std::chrono::duration<float>(wait));
+        }
+    }
+}
+
+// 📨 COMMANDES : postées par le thread de rendu, appliquées ici entre deux ticks
+void GameEngine::PostCommand(Command command) {
+    std::lock_guard<std::mutex> lock(mCommandMutex);
+    mPendingCommands.push_back(command);
+}
+
+bool GameEngine::ApplyCommands() {
+    {
+        std::lock_guard<std::mutex> lock(mCommandMutex);
+        mAppliedCommands.swap(mPendingCommands);
+    }
+    for (Command command : mAppliedCommands) {
+        switch (command) {
+            case Command::Reset:
+                ResetWorld();
+                mAccumulatedTime = 0.0f;
+                ECO_LOG_INFO("🔄 Simulation réinitialisée");
+                break;
+
+            case Command::SpawnFood:
+                mEcosystem.SpawnFood(10);
+                mReplayRecorder.RecordSpawnFood(10);
+                ECO_LOG_INFO("🍎 Nourriture ajoutée");
+                break;
+
+            case Command::TogglePause:
+                mIsPaused = !mIsPaused;
+                mReplayRecorder.RecordPause(mIsPaused);
+                ECO_LOG_INFO((mIsPaused ? "⏸️ Simulation en pause" : "▶️ Simulation reprise"));
+                break;
+
+            case Command::SpeedUp:
+            case Command::SlowDown:
+                mTimeScale = command == Command::SpeedUp ? mTimeScale * 1.5f : mTimeScale / 1.5f;
+                mReplayRecorder.RecordTimeScale(mTimeScale);
+                ECO_LOG_INFO((command == Command::SpeedUp ? "⏩ Vitesse: " : "⏪ Vitesse: ") << mTimeScale << "x");
+                break;
+
+            case Command::SaveSnapshot:
+                mEcosystem.SaveSnapshot(mSnapshotPath);
+                break;
+
+            case Command::LoadSnapshot:
+                LoadSnapshot(mSnapshotPath);
+                break;
+
+            case Command::RefreshFrame:
+                break;
         }
-        
-        Render();
-        
-        // Limitation à ~60 FPS
-        SDL_Delay(16);
     }
+    const bool applied = !mAppliedCommands.empty();
+    mAppliedCommands.clear();
+    return applied;
 }
 
-// 🧹 FERMETURE
+// 📸 PUBLICATION D'UNE IMAGE (remplie dans le tampon libre, jamais lu par le rendu)
+void GameEngine::PublishFrame() {
+    RenderFrame& frame = mFrames.GetWriteBuffer();
+    RenderFrame::Region region = GetRequestedRegion();
+    const float paddingX = (region.maxX - region.minX) * CapturePadding;
+    const float paddingY = (region.maxY - region.minY) * CapturePadding;
+    region = {region.minX - paddingX, region.minY - paddingY, region.maxX + paddingX, region.maxY + paddingY};
+    frame.Capture(mEcosystem, region);
+    mCapturedRegion = region;
+    frame.publishedAt = std::chrono::steady_clock::now();
+    frame.pendingTime = mAccumulatedTime;
+    frame.timeScale = mTimeScale;
+    frame.paused = mIsPaused;
+    frame.averageSubsteps = mAverageSubsteps;
+    frame.droppedSimulationTime = mDroppedSimulationTime;
+    frame.hasProfile = mShowProfiler.load(std::memory_order_relaxed);
+    if (frame.hasProfile) {
+        for (size_t i = 0; i < Profiler::PhaseCount; ++i) {
+            frame.profile[i] = mEcosystem.GetProfiler().GetSummary(static_cast<ProfilePhase>(i));
+        }
+    }
+    mFrames.Publish();
+}
+
+// 🎥 ZONE DEMANDÉE PAR LE RENDU (lecture côté simulation)
+RenderFrame::Region GameEngine::GetRequestedRegion() const {
+    return {mViewMinX.load(std::memory_order_relaxed) - CaptureMargin, mViewMinY.load(std::memory_order_relaxed) - CaptureMargin,
+            mViewMaxX.load(std::memory_order_relaxed) + CaptureMargin, mViewMaxY.load(std::memory_order_relaxed) + CaptureMargin};
+}
+
+// ⏱ BOUCLE À PAS FIXE
+// Consomme le temps accumulé par pas de FixedTimeStep, dans la limite du budget
+// de sous-pas par image. Retourne le nombre de ticks exécutés.
+int GameEngine::RunFixedSteps(float frameTime) {
+    mAccumulatedTime += frameTime;
+
+    int substeps = 0;
+    while (mAccumulatedTime >= FixedTimeStep && substeps < mMaxSubstepsPerFrame) {
+        Update(FixedTimeStep);
+        mAccumulatedTime -= FixedTimeStep;
+        ++substeps;
+    }
+
+    // Budget épuisé : on abandonne le retard plutôt que de s'enfoncer (spirale de la mort)
+    if (mAccumulatedTime >= FixedTimeStep) {
+        float dropped = mAccumulatedTime - std::fmod(mAccumulatedTime, FixedTimeStep);
+        mDroppedSimulationTime += dropped;
+        mAccumulatedTime -= dropped;
+    }
+    return substeps;
+}
+
+// 🧹 FERMETURE (le thread de simulation est arrêté avant de toucher au monde)
 void GameEngine::Shutdown() {
     mIsRunning = false;
-    std::cout << "🔄 Moteur de jeu arrêté" << std::endl;
+    if (mSimulationThread.joinable()) {
+        mSimulationThread.join();
+    }
+    mReplayRecorder.Close(mEcosystem);
+    ECO_LOG_INFO("🔄 Moteur de jeu arrêté");
+}
+
+// 📝 EXPORT CSV DU PROFILEUR
+bool GameEngine::StartProfileCsv(const std::string& path) {
+    if (!mEcosystem.GetProfiler().OpenCsv(path)) {
+        ECO_LOG_WARNING("⚠ Export du profilage impossible: " << path);
+        return false;
+    }
+    ECO_LOG_INFO("📝 Durées par tick écrites dans " << path);
+    return true;
+}
+
+// 📈 SÉRIE TEMPORELLE DES STATISTIQUES
+bool GameEngine::StartStatistics(const std::string& path, const std::string& csvPath) {
+    if (!mEcosystem.GetStatisticsRecorder().Open(path, csvPath)) {
+        ECO_LOG_WARNING("⚠ Enregistrement des statistiques impossible: " << path << " " << csvPath);
+        return false;
+    }
+    ECO_LOG_INFO("📈 Statistiques de chaque tick écrites dans " << (path.empty() ? csvPath : path));
+    return true;
+}
+
+// 📂 REPRISE D'UN MONDE SAUVEGARDÉ
+bool GameEngine::LoadSnapshot(const std::string& path) {
+    if (!mEcosystem.LoadSnapshot(path)) {
+        return false;
+    }
+    // L'interpolation repart du tick chargé ; la caméra suit la taille du monde de l'image suivante
+    mAccumulatedTime = 0.0f;
+    mSnapshotPath = path;
+    mReplayRecorder.RecordLoadSnapshot(path, mEcosystem);
+    return true;
+}
+
+// 🎲 GRAINE DU MONDE (sinon tirée de l'entropie à la construction)
+void GameEngine::SetSeed(uint64_t seed) {
+    mEcosystem.SetSeed(seed);
+}
+
+// ⏺ ENREGISTREMENT DU REJEU
+// Ouvert sur le monde neuf : la graine notée suffit à reproduire l'Initialize qui suit
+bool GameEngine::StartRecording(const std::string& path, uint32_t checkpointInterval) {
+    ReplayHeader header;
+    header.worldWidth = mEcosystem.GetWorldWidth();
+    header.worldHeight = mEcosystem.GetWorldHeight();
+    header.maxEntities = mEcosystem.GetMaxEntities();
+    header.seed = mEcosystem.GetSeed();
+    header.tickDuration = FixedTimeStep;
+    header.checkpointInterval = checkpointInterval;
+    if (!mReplayRecorder.Open(path, header)) {
+        ECO_LOG_WARNING("⚠ Enregistrement du rejeu impossible: " << path);
+        return false;
+    }
+    return true;
+}
+
+// 🌱 NOUVEAU MONDE
+void GameEngine::ResetWorld() {
+    mEcosystem.Initialize(20, 5, 30);  // 20 herbivores, 5 carnivores, 30 plantes
+    mReplayRecorder.RecordInitialize(20, 5, 30, mEcosystem);
 }
 
 // 🎮 GESTION DES ÉVÉNEMENTS
@@ -70,6 +339,11 @@ void GameEngine::HandleEvents() {
             case SDL_EVENT_KEY_DOWN:
                 HandleInput(event.key.key);
                 break;
+
+            case SDL_EVENT_MOUSE_WHEEL:
+            case SDL_EVENT_MOUSE_MOTION:
+                HandleMouse(event);
+                break;
         }
     }
 }
@@ -82,68 +356,136 @@ void GameEngine::HandleInput(SDL_Keycode key) {
             break;
             
         case SDLK_SPACE:
-            mIsPaused = !mIsPaused;
-            std::cout << (mIsPaused ? "⏸️ Simulation en pause" : "▶️ Simulation reprise") << std::endl;
+            PostCommand(Command::TogglePause);
             break;
             
         case SDLK_R:
-            mEcosystem.Initialize(20, 5, 30);
-            std::cout << "🔄 Simulation réinitialisée" << std::endl;
+            PostCommand(Command::Reset);
             break;
             
         case SDLK_F:
-            mEcosystem.SpawnFood(10);
-            std::cout << "🍎 Nourriture ajoutée" << std::endl;
+            PostCommand(Command::SpawnFood);
             break;
             
         case SDLK_UP:
-            mTimeScale *= 1.5f;
-            std::cout << "⏩ Vitesse: " << mTimeScale << "x" << std::endl;
+            PostCommand(Command::SpeedUp);
             break;
             
         case SDLK_DOWN:
-            mTimeScale /= 1.5f;
-            std::cout << "⏪ Vitesse: " << mTimeScale << "x" << std::endl;
+            PostCommand(Command::SlowDown);
+            break;
+
+        case SDLK_EQUALS:
+        case SDLK_MINUS: {
+            Vector2D screenCenter(mWindow.GetWidth() / 2.0f, mWindow.GetHeight() / 2.0f);
+            mCamera.ZoomAt(key == SDLK_EQUALS ? 1.25f : 0.8f, screenCenter);
+            break;
+        }
+
+        case SDLK_C:
+            mCamera.FitWorld(mCameraWorldWidth, mCameraWorldHeight);
             break;
+
+        case SDLK_P:
+            mShowProfiler = !mShowProfiler;
+            PostCommand(Command::RefreshFrame);
+            break;
+
+        case SDLK_F5:
+            PostCommand(Command::SaveSnapshot);
+            break;
+
+        case SDLK_F9:
+            PostCommand(Command::LoadSnapshot);
+            break;
+    }
+}
+
+// 🖱 CAMÉRA À LA SOURIS : molette = zoom sous le curseur, glisser = déplacement
+void GameEngine::HandleMouse(const SDL_Event& event) {
+    if (event.type == SDL_EVENT_MOUSE_WHEEL) {
+        float factor = event.wheel.y > 0.0f ? 1.1f : (event.wheel.y < 0.0f ? 1.0f / 1.1f : 1.0f);
+        mCamera.ZoomAt(factor, Vector2D(event.wheel.mouse_x, event.wheel.mouse_y));
+    } else if (event.motion.state & (SDL_BUTTON_LMASK | SDL_BUTTON_RMASK)) {
+        mCamera.Pan(event.motion.xrel, event.motion.yrel);
     }
 }
 
 // 🔄 MISE À JOUR
 void GameEngine::Update(float deltaTime) {
-    mEcosystem -> Update(deltaTime);//appel de la fonction
+    // Rendu mesuré sur l'autre thread depuis le tick précédent (le profileur n'appartient qu'à ce thread)
+    const int64_t renderNs = mPendingRenderNs.exchange(0, std::memory_order_relaxed);
+    if (Profiler::Enabled && renderNs > 0) {
+        mEcosystem.GetProfiler().Record(ProfilePhase::Render, renderNs);
+    }
+    mEcosystem.Update(deltaTime);//appel de la fonction
+    mReplayRecorder.EndTick(mEcosystem);
 
     
-    // Affichage occasionnel des statistiques
-    static float statsTimer = 0.0f;
-    statsTimer += deltaTime;
-    if (statsTimer >= 2.0f) {
+    // Affichage occasionnel des statistiques (la série complète passe par StartStatistics)
+    mStatsTimer += deltaTime;
+    if (mStatsTimer >= 2.0f) {
         auto stats = mEcosystem.GetStatistics();
-        std::cout << "📊 Stats - Herbivores: " << stats.totalHerbivores 
+        ECO_LOG_INFO("📊 Stats - Herbivores: " << stats.totalHerbivores 
                   << ", Carnivores: " << stats.totalCarnivores
                   << ", Plantes: " << stats.totalPlants
-                  << ", Naissances: " << stats.birthsToday
-                  << ", Morts: " << stats.deathsToday << std::endl;
-        statsTimer = 0.0f;
+                  << ", Jour " << stats.day
+                  << " - Naissances: " << stats.birthsToday
+                  << ", Morts: " << stats.deathsToday
+                  << ", Ticks/image: " << mAverageSubsteps);
+        mStatsTimer = 0.0f;
     }
 }
 
 // 🎨 RENDU
-void GameEngine::Render() {
-    mWindow.Clear();
-    
-    // Rendu de l'écosystème
-    mEcosystem.Render(mWindow.GetRenderer());
-    
-    // Ici on ajouterait l'interface utilisateur
-    RenderUI();
+void GameEngine::Render(const RenderFrame& frame, float alpha) {
+    {
+        // Mesuré sans l'interface ni la présentation (attente de la synchro verticale)
+        const auto start = std::chrono::steady_clock::now();
+        mWindow.Clear();
+
+        // Rendu de l'écosystème
+        mRenderer.DrawEcosystem(frame, mCamera, alpha);
+        if (Profiler::Enabled) {
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            mPendingRenderNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                                       std::memory_order_relaxed);
+        }
+    }
+
+    RenderUI(frame);
     
     mWindow.Present();
 }
 
 // 📊 INTERFACE UTILISATEUR
-void GameEngine::RenderUI() {
-    // Pour l'instant, interface texte dans la console
-    // Une vraie interface graphique serait implémentée ici
+void GameEngine::RenderUI(const RenderFrame& frame) {
+    if (mShowProfiler) {
+        mRenderer.DrawProfilerOverlay(frame, 10.0f, 10.0f);
+    }
+}
+
+// 🏷 TITRE : vitesse, ticks par image, coût du rendu, images perdues et dupliquées
+void GameEngine::UpdateTitle(const RenderFrame& frame) {
+    std::ostringstream title;
+    title << "Simulateur d'Écosystème Intelligent - " << frame.timeScale << "x - "
+          << frame.averageSubsteps << " ticks/image - "
+          << mRenderer.GetLastVisibleEntities() << "/" << frame.entityCount << " entités visibles, "
+          << mRenderer.GetLastQuadCount() << " quads en " << mRenderer.GetLastDrawCalls() << " appel(s) - "
+          << "images perdues: " << mFrames.GetDroppedFrames() << ", dupliquées: " << mDuplicatedFrames;
+    if (frame.droppedSimulationTime > 0.0f) {
+        title << " (retard abandonné: " << frame.droppedSimulationTime << " s)";
+    }
+    mWindow.SetTitle(title.str());
+}
+
+// 🎥 VUE PUBLIÉE POUR LA SIMULATION (la prochaine image copie cette zone)
+void GameEngine::PublishView() {
+    const Graphics::Camera::Rect visible = mCamera.GetVisibleRect();
+    mViewMinX.store(visible.minX, std::memory_order_relaxed);
+    mViewMinY.store(visible.minY, std::memory_order_relaxed);
+    mViewMaxX.store(visible.maxX, std::memory_order_relaxed);
+    mViewMaxY.store(visible.maxY, std::memory_order_relaxed);
 }
 
 } // namespace Core
@@ -0,0 +1,259 @@
+#include "Core/HeadlessRunner.h"
+#include "Core/Logger.h"
+#include "Core/AllocationCounter.h"
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+HeadlessRunner::HeadlessRunner(const HeadlessConfig& config, const ReplayLog* replay)
+    : mConfig(config),
+      mEcosystem(config.worldWidth, config.worldHeight, config.maxEntities, config.threadCount),
+      mReplay(replay)
+{
+    if (replay) {
+        mEcosystem.SetSeed(replay->header.seed);
+        return;
+    }
+    if (config.seed != 0) {
+        mEcosystem.SetSeed(config.seed);
+    }
+    mEcosystem.SetSpecies(config.species);
+}
+
+// 🎬 MONDE DE DÉPART DU JOURNAL
+void HeadlessRunner::ApplyReplayHeader(const ReplayLog& replay, HeadlessConfig& config) {
+    config.worldWidth = replay.header.worldWidth;
+    config.worldHeight = replay.header.worldHeight;
+    config.maxEntities = replay.header.maxEntities;
+    config.seed = replay.header.seed;
+    config.tickDuration = replay.header.tickDuration;
+    config.maxSimulatedTime = 0.0f;
+}
+
+// 🚀 BOUCLE SANS RENDU NI LIMITATION DE FRÉQUENCE
+HeadlessRunner::Result HeadlessRunner::Run() {
+    Result result{};
+    result.firstMismatchTick = -1;
+    result.herbivoreExtinctionTick = -1;
+    result.carnivoreExtinctionTick = -1;
+    // Journal ouvert sur le monde neuf : la graine d'en-tête précède tout tirage
+    if (!mConfig.recordPath.empty()) {
+        ReplayHeader header;
+        header.worldWidth = mEcosystem.GetWorldWidth();
+        header.worldHeight = mEcosystem.GetWorldHeight();
+        header.maxEntities = mEcosystem.GetMaxEntities();
+        header.seed = mEcosystem.GetSeed();
+        header.tickDuration = mConfig.tickDuration;
+        header.checkpointInterval = mConfig.checkpointInterval;
+        if (!mRecorder.Open(mConfig.recordPath, header)) {
+            ECO_LOG_WARNING("⚠ Enregistrement du rejeu impossible: " << mConfig.recordPath);
+        }
+    }
+    if (mReplay) {
+        // Le monde de départ vient des premiers événements du journal
+    } else if (mConfig.loadSnapshotPath.empty()) {
+        mEcosystem.Initialize(mConfig.initialHerbivores, mConfig.initialCarnivores, mConfig.initialPlants);
+        mRecorder.RecordInitialize(mConfig.initialHerbivores, mConfig.initialCarnivores, mConfig.initialPlants, mEcosystem);
+    } else if (!mEcosystem.LoadSnapshot(mConfig.loadSnapshotPath)) {
+        // Pas de repli silencieux sur un monde neuf : le calcul demandé n'aurait pas de sens
+        result.snapshotFailed = true;
+        return result;
+    } else {
+        mRecorder.RecordLoadSnapshot(mConfig.loadSnapshotPath, mEcosystem);
+    }
+    if (!mConfig.profileCsvPath.empty() && !mEcosystem.GetProfiler().OpenCsv(mConfig.profileCsvPath)) {
+        ECO_LOG_WARNING("⚠ Export du profilage impossible: " << mConfig.profileCsvPath);
+    }
+    StatisticsRecorder& recorder = mEcosystem.GetStatisticsRecorder();
+    if ((!mConfig.statisticsPath.empty() || !mConfig.statisticsCsvPath.empty()) &&
+        !recorder.Open(mConfig.statisticsPath, mConfig.statisticsCsvPath)) {
+        ECO_LOG_WARNING("⚠ Enregistrement des statistiques impossible: "
+                        << mConfig.statisticsPath << " " << mConfig.statisticsCsvPath);
+    }
+
+    // Sans limite explicite, une minute simulée ; un rejeu va jusqu'au bout du journal (ou jusqu'à --ticks)
+    long long tickLimit = mConfig.maxTicks;
+    if (mReplay) {
+        const long long replayTicks = static_cast<long long>(mReplay->GetLastTick());
+        tickLimit = tickLimit > 0 ? std::min(tickLimit, replayTicks) : replayTicks;
+    } else if (tickLimit <= 0 && mConfig.maxSimulatedTime <= 0.0f) {
+        tickLimit = static_cast<long long>(60.0f / mConfig.tickDuration);
+    }
+    size_t nextEvent = 0;
+    result.minimumPopulation = std::numeric_limits<int>::max();
+
+    auto start = std::chrono::steady_clock::now();
+    const uint64_t startAllocations = AllocationCounter::Read().allocations;
+    uint64_t steadyStartAllocations = 0;
+    bool steady = false;
+
+    while (true) {
+        // Événements du journal entre deux ticks, dans l'ordre d'enregistrement
+        bool replayFailed = false;
+        while (mReplay && !replayFailed && nextEvent < mReplay->events.size() &&
+               mReplay->events[nextEvent].tick <= static_cast<uint64_t>(result.ticks)) {
+            replayFailed = !ApplyReplayEvent(mReplay->events[nextEvent++], result);
+        }
+        if (replayFailed) break;
+        TrackPopulation(result);          // État entre deux ticks, monde de départ compris
+        if (mReplay ? result.ticks >= tickLimit : tickLimit > 0 && result.ticks >= tickLimit) break;
+        if (mConfig.maxSimulatedTime > 0.0f && result.simulatedSeconds >= mConfig.maxSimulatedTime) break;
+
+        // Régime établi : seconde moitié de l'exécution, population stabilisée
+        if (!steady && (tickLimit > 0 ? result.ticks >= tickLimit / 2
+                                      : result.simulatedSeconds >= mConfig.maxSimulatedTime / 2.0f)) {
+            steady = true;
+            steadyStartAllocations = AllocationCounter::Read().allocations;
+            result.steadyStateTicks = result.ticks;
+        }
+
+        mEcosystem.Update(mConfig.tickDuration);
+        mRecorder.EndTick(mEcosystem);
+        result.ticks++;
+        result.simulatedSeconds += mConfig.tickDuration;
+    }
+
+    const uint64_t endAllocations = AllocationCounter::Read().allocations;
+    result.allocations = endAllocations - startAllocations;
+    result.steadyStateAllocations = steady ? endAllocations - steadyStartAllocations : 0;
+    result.steadyStateTicks = result.ticks - result.steadyStateTicks;
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    result.wallSeconds = elapsed.count();
+    result.ticksPerSecond = result.wallSeconds > 0.0 ? result.ticks / result.wallSeconds : 0.0;
+    result.finalStatistics = mEcosystem.GetStatistics();
+    result.finalEntityCount = mEcosystem.GetEntityCount();
+    result.minimumPopulation = std::min(result.minimumPopulation, result.maximumPopulation);
+    for (size_t i = 0; i < Profiler::PhaseCount; ++i) {
+        result.phases[i] = mEcosystem.GetProfiler().GetSummary(static_cast<ProfilePhase>(i));
+    }
+    mEcosystem.GetProfiler().CloseCsv();
+    recorder.Close();           // Derniers blocs, hors du temps mesuré
+    mRecorder.Close(mEcosystem);
+    if (!mConfig.saveSnapshotPath.empty() && !mEcosystem.SaveSnapshot(mConfig.saveSnapshotPath)) {
+        result.snapshotFailed = true;
+    }
+    return result;
+}
+
+// 📈 SUIVI DE LA POPULATION (compteurs tenus à jour par Ecosystem : O(1) par tick)
+void HeadlessRunner::TrackPopulation(Result& result) const {
+    const int population = mEcosystem.GetEntityCount();
+    result.minimumPopulation = std::min(result.minimumPopulation, population);
+    result.maximumPopulation = std::max(result.maximumPopulation, population);
+    // Statistiques par type rafraîchies par Update : rien à lire avant le premier tick
+    if (result.ticks == 0) return;
+    const Ecosystem::Statistics& stats = mEcosystem.GetStatistics();
+    if (stats.totalHerbivores == 0 && result.herbivoreExtinctionTick < 0) {
+        result.herbivoreExtinctionTick = result.ticks;
+    }
+    if (stats.totalCarnivores == 0 && result.carnivoreExtinctionTick < 0) {
+        result.carnivoreExtinctionTick = result.ticks;
+    }
+}
+
+// 🎬 UN ÉVÉNEMENT DU JOURNAL (réenregistré si --record accompagne --replay)
+bool HeadlessRunner::ApplyReplayEvent(const ReplayEvent& event, Result& result) {
+    switch (event.type) {
+        case ReplayEventType::Initialize:
+            mEcosystem.Initialize(event.values[0], event.values[1], event.values[2]);
+            mRecorder.RecordInitialize(event.values[0], event.values[1], event.values[2], mEcosystem);
+            break;
+        case ReplayEventType::SpawnFood:
+            mEcosystem.SpawnFood(event.values[0]);
+            mRecorder.RecordSpawnFood(event.values[0]);
+            break;
+        case ReplayEventType::LoadSnapshot:
+            if (!mEcosystem.LoadSnapshot(event.path)) {
+                result.snapshotFailed = true;
+                return false;
+            }
+            mRecorder.RecordLoadSnapshot(event.path, mEcosystem);
+            break;
+        // Cadence réelle seulement : sans effet sur les ticks rejoués
+        case ReplayEventType::Pause:
+            mRecorder.RecordPause(event.values[0] != 0);
+            break;
+        case ReplayEventType::TimeScale:
+            mRecorder.RecordTimeScale(event.timeScale);
+            break;
+        case ReplayEventType::Checkpoint:
+        case ReplayEventType::End: {
+            const uint64_t hash = mEcosystem.ComputeStateHash();
+            result.checkpointsVerified++;
+            if (hash != event.hash && result.checkpointMismatches++ == 0) {
+                result.firstMismatchTick = static_cast<long long>(event.tick);
+                char replayed[17];
+                char recorded[17];
+                std::snprintf(replayed, sizeof(replayed), "%016" PRIx64, hash);
+                std::snprintf(recorded, sizeof(recorded), "%016" PRIx64, event.hash);
+                ECO_LOG_WARNING("⚠ Rejeu divergent au tick " << event.tick << ": empreinte " << replayed
+                                << " au lieu de " << recorded);
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+// 📊 RAPPORT FINAL
+void HeadlessRunner::PrintReport(const Result& result) {
+    const auto& stats = result.finalStatistics;
+    Logger::Instance().Flush();     // Le rapport passe après les messages en attente
+    std::cout << "📊 Simulation headless terminée" << std::endl;
+    std::cout << "   Ticks: " << result.ticks
+              << " (" << result.simulatedSeconds << " s simulées en " << result.wallSeconds << " s)" << std::endl;
+    std::cout << "   Débit: " << result.ticksPerSecond << " ticks/s" << std::endl;
+    std::cout << "   Entités: " << result.finalEntityCount
+              << " - Herbivores: " << stats.totalHerbivores
+              << ", Carnivores: " << stats.totalCarnivores
+              << ", Plantes: " << stats.totalPlants
+              << ", Nourriture: " << stats.totalFood
+              << ", Naissances: " << stats.totalBirths
+              << ", Morts: " << stats.totalDeaths << std::endl;
+    std::cout << "   Jour " << stats.day << " - Naissances: " << stats.birthsToday
+              << ", Morts: " << stats.deathsToday << std::endl;
+    std::cout << "   Population: " << result.minimumPopulation << " à " << result.maximumPopulation << " entités";
+    if (result.herbivoreExtinctionTick >= 0) {
+        std::cout << ", herbivores éteints au tick " << result.herbivoreExtinctionTick;
+    }
+    if (result.carnivoreExtinctionTick >= 0) {
+        std::cout << ", carnivores éteints au tick " << result.carnivoreExtinctionTick;
+    }
+    std::cout << std::endl;
+    if (result.checkpointsVerified > 0) {
+        std::cout << "   Rejeu: " << result.checkpointsVerified << " empreintes vérifiées, ";
+        if (result.checkpointMismatches == 0) {
+            std::cout << "identique à l'enregistrement" << std::endl;
+        } else {
+            std::cout << result.checkpointMismatches << " divergente(s), première au tick "
+                      << result.firstMismatchTick << std::endl;
+        }
+    }
+    if (AllocationCounter::Enabled) {
+        double perTick = result.steadyStateTicks > 0
+                       ? static_cast<double>(result.steadyStateAllocations) / result.steadyStateTicks : 0.0;
+        std::cout << "   Allocations: " << result.allocations << " au total, "
+                  << result.steadyStateAllocations << " sur les " << result.steadyStateTicks
+                  << " derniers ticks (" << perTick << "/tick)" << std::endl;
+    }
+    if (Profiler::Enabled && result.ticks > 0) {
+        std::cout << "   Phases (ms, " << result.phases[static_cast<size_t>(ProfilePhase::Tick)].samples
+                  << " derniers ticks) - min / moyenne / p99:" << std::endl;
+        for (size_t i = 0; i < Profiler::PhaseCount; ++i) {
+            const Profiler::Summary& phase = result.phases[i];
+            if (phase.samples == 0) continue;       // Pas de rendu en headless
+            std::cout << "     " << Profiler::GetName(static_cast<ProfilePhase>(i)) << ": "
+                      << phase.minimumMs << " / " << phase.averageMs << " / " << phase.p99Ms << std::endl;
+        }
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,142 @@
+#include "Core/JobSystem.h"
+#include <algorithm>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR : une file par thread, le thread appelant occupe la file 0
+JobSystem::JobSystem(int threadCount)
+    : mPendingTasks(0), mStopping(false)
+{
+    if (threadCount <= 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (int i = 0; i < threadCount; ++i) {
+        mQueues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (int i = 1; i < threadCount; ++i) {
+        mWorkers.emplace_back(&JobSystem::WorkerLoop, this, static_cast<size_t>(i));
+    }
+}
+
+// 🗑 DESTRUCTEUR : réveil et attente de tous les travailleurs
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mStopping = true;
+    }
+    mWakeCondition.notify_all();
+    for (auto& worker : mWorkers) {
+        worker.join();
+    }
+}
+
+// ⚙ EXÉCUTION PARALLÈLE
+void JobSystem::ParallelFor(size_t count, size_t chunkSize, const ChunkFunction& function) {
+    if (count == 0) return;
+    chunkSize = std::max<size_t>(1, chunkSize);
+    const size_t chunkCount = ChunkCount(count, chunkSize);
+
+    // Chemin direct : un seul thread ou une seule tranche
+    if (mWorkers.empty() || chunkCount == 1) {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            size_t begin = chunk * chunkSize;
+            function(chunk, begin, std::min(count, begin + chunkSize));
+        }
+        return;
+    }
+
+    Batch batch{&function, count, chunkSize, {chunkCount}};
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mPendingTasks += chunkCount;
+    }
+
+    // Distribution en blocs contigus : chaque file reçoit une portion du lot
+    // (les files sont vides entre deux lots : leur capacité est réutilisée)
+    const size_t queueCount = mQueues.size();
+    for (size_t q = 0; q < queueCount; ++q) {
+        size_t first = chunkCount * q / queueCount;
+        size_t last = chunkCount * (q + 1) / queueCount;
+        WorkQueue& queue = *mQueues[q];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.clear();
+        for (size_t chunk = first; chunk < last; ++chunk) {
+            queue.tasks.push_back({&batch, chunk});
+        }
+        queue.head = 0;
+    }
+    mWakeCondition.notify_all();
+
+    // Le thread appelant travaille aussi, puis attend les tranches volées encore en cours
+    while (batch.remaining.load(std::memory_order_acquire) > 0) {
+        if (!TryRunOne(0)) {
+            std::unique_lock<std::mutex> lock(mSleepMutex);
+            mDoneCondition.wait(lock, [&batch] {
+                return batch.remaining.load(std::memory_order_acquire) == 0;
+            });
+        }
+    }
+}
+
+// 🔁 BOUCLE D'UN TRAVAILLEUR
+void JobSystem::WorkerLoop(size_t queueIndex) {
+    while (true) {
+        if (TryRunOne(queueIndex)) continue;
+
+        std::unique_lock<std::mutex> lock(mSleepMutex);
+        mWakeCondition.wait(lock, [this] { return mStopping || mPendingTasks.load() > 0; });
+        if (mStopping) return;
+    }
+}
+
+// ▶ UNE TÂCHE : d'abord la file locale, sinon un vol
+bool JobSystem::TryRunOne(size_t queueIndex) {
+    Task task;
+    if (PopLocal(queueIndex, task) || Steal(queueIndex, task)) {
+        mPendingTasks.fetch_sub(1);
+        Execute(task);
+        return true;
+    }
+    return false;
+}
+
+// 📥 FILE LOCALE : dépilage par l'arrière (tranches les plus récentes)
+bool JobSystem::PopLocal(size_t queueIndex, Task& task) {
+    WorkQueue& queue = *mQueues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.head == queue.tasks.size()) return false;
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    return true;
+}
+
+// 🦝 VOL : par l'avant des autres files, en commençant par la voisine
+bool JobSystem::Steal(size_t thiefIndex, Task& task) {
+    const size_t queueCount = mQueues.size();
+    for (size_t offset = 1; offset < queueCount; ++offset) {
+        WorkQueue& victim = *mQueues[(thiefIndex + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.head == victim.tasks.size()) continue;
+        task = victim.tasks[victim.head++];
+        return true;
+    }
+    return false;
+}
+
+// ⚙ EXÉCUTION D'UNE TRANCHE
+void JobSystem::Execute(const Task& task) {
+    Batch& batch = *task.batch;
+    size_t begin = task.chunkIndex * batch.chunkSize;
+    size_t end = std::min(batch.count, begin + batch.chunkSize);
+    (*batch.function)(task.chunkIndex, begin, end);
+
+    if (batch.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Dernière tranche : le verrou évite un réveil perdu de l'appelant
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mDoneCondition.notify_all();
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
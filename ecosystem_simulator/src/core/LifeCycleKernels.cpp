@@ -0,0 +1,368 @@
+#include "Core/LifeCycleKernels.h"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+// Chemins vectoriels : x86 uniquement, sauf demande explicite du scalaire
+#if !defined(ECOSYSTEM_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#define ECOSYSTEM_X86_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define ECOSYSTEM_TARGET_SSE2
+#define ECOSYSTEM_TARGET_AVX2
+#else
+#define ECOSYSTEM_TARGET_SSE2 __attribute__((target("sse2")))
+#define ECOSYSTEM_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+// 📏 CHEMIN SCALAIRE (référence, et fin de tranche des chemins vectoriels)
+void ConsumeEnergyScalar(EntityStore& store, size_t begin, size_t end, float deltaTime,
+                         const std::array<float, SpeciesCount>& drainPerSecond) {
+    for (size_t i = begin; i < end; ++i) {
+        const float drain = drainPerSecond[static_cast<size_t>(store.type[i])];
+        // Les entités mortes gardent leur énergie (le masque évite un branchement)
+        store.energy[i] -= drain * deltaTime * static_cast<float>(store.alive[i]);
+    }
+}
+
+void AgeScalar(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    // Âge continu : un pas court fait vieillir au lieu d'être tronqué à zéro
+    const float increment = deltaTime * LifeCycleKernels::AgingRate;
+    for (size_t i = begin; i < end; ++i) {
+        store.age[i] += increment * static_cast<float>(store.alive[i]);
+    }
+}
+
+void IntegrateScalar(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    for (size_t i = begin; i < end; ++i) {
+        if (!store.alive[i] || !LifeCycleKernels::IsMobile[static_cast<size_t>(store.type[i])]) continue;
+        const float vx = store.velocityX[i];
+        const float vy = store.velocityY[i];
+        store.positionX[i] += vx * deltaTime * LifeCycleKernels::MovementScale;
+        store.positionY[i] += vy * deltaTime * LifeCycleKernels::MovementScale;
+        const float speed = std::sqrt(vx * vx + vy * vy);
+        store.energy[i] -= speed * deltaTime * LifeCycleKernels::MovementEnergyCost;
+    }
+}
+
+void CollectDeathsScalar(const EntityStore& store, size_t begin, size_t end, LifeCycleCommands& commands) {
+    for (size_t i = begin; i < end; ++i) {
+        const bool starving = store.energy[i] <= 0.0f;
+        if (store.alive[i] && (starving || store.age[i] >= store.maxAge[i])) {
+            commands.deaths.push_back({i, starving});
+        }
+    }
+}
+
+#ifdef ECOSYSTEM_X86_SIMD
+
+// 🧮 SSE2 : 4 entités par itération
+
+// Quatre octets (type ou alive) étendus en entiers 32 bits
+ECOSYSTEM_TARGET_SSE2 inline __m128i LoadBytes4(const void* source) {
+    int packed;
+    std::memcpy(&packed, source, sizeof(packed));
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+}
+
+// Sélection sans branchement : mask ? chosen : other
+ECOSYSTEM_TARGET_SSE2 inline __m128 Select4(__m128 mask, __m128 chosen, __m128 other) {
+    return _mm_or_ps(_mm_and_ps(mask, chosen), _mm_andnot_ps(mask, other));
+}
+
+// Table indexée par type (une comparaison par espèce, pas de gather en SSE2)
+ECOSYSTEM_TARGET_SSE2 inline __m128 LookupType4(__m128i types, const std::array<float, SpeciesCount>& table) {
+    __m128 result = _mm_set1_ps(table[0]);
+    for (size_t type = 1; type < SpeciesCount; ++type) {
+        const __m128i matches = _mm_cmpeq_epi32(types, _mm_set1_epi32(static_cast<int>(type)));
+        result = Select4(_mm_castsi128_ps(matches), _mm_set1_ps(table[type]), result);
+    }
+    return result;
+}
+
+ECOSYSTEM_TARGET_SSE2 void ConsumeEnergySSE2(EntityStore& store, size_t begin, size_t end, float deltaTime,
+                                              const std::array<float, SpeciesCount>& drainPerSecond) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const __m128 drain = LookupType4(LoadBytes4(&store.type[i]), drainPerSecond);
+        const __m128 alive = _mm_cvtepi32_ps(LoadBytes4(&store.alive[i]));
+        const __m128 energy = _mm_loadu_ps(&store.energy[i]);
+        _mm_storeu_ps(&store.energy[i], _mm_sub_ps(energy, _mm_mul_ps(_mm_mul_ps(drain, dt), alive)));
+    }
+    ConsumeEnergyScalar(store, i, end, deltaTime, drainPerSecond);
+}
+
+ECOSYSTEM_TARGET_SSE2 void AgeSSE2(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    const __m128 increment = _mm_set1_ps(deltaTime * LifeCycleKernels::AgingRate);
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const __m128 alive = _mm_cvtepi32_ps(LoadBytes4(&store.alive[i]));
+        const __m128 age = _mm_loadu_ps(&store.age[i]);
+        _mm_storeu_ps(&store.age[i], _mm_add_ps(age, _mm_mul_ps(increment, alive)));
+    }
+    AgeScalar(store, i, end, deltaTime);
+}
+
+ECOSYSTEM_TARGET_SSE2 void IntegrateSSE2(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 scale = _mm_set1_ps(LifeCycleKernels::MovementScale);
+    const __m128 cost = _mm_set1_ps(LifeCycleKernels::MovementEnergyCost);
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        // Masque « vivant et mobile » : type → bit de mobilité par comparaison
+        const __m128i types = LoadBytes4(&store.type[i]);
+        __m128i mobile = _mm_setzero_si128();
+        for (size_t type = 0; type < SpeciesCount; ++type) {
+            if (!LifeCycleKernels::IsMobile[type]) continue;
+            mobile = _mm_or_si128(mobile, _mm_and_si128(_mm_cmpeq_epi32(types, _mm_set1_epi32(static_cast<int>(type))),
+                                                        _mm_set1_epi32(1)));
+        }
+        const __m128i alive = LoadBytes4(&store.alive[i]);
+        const __m128 mask = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_and_si128(mobile, alive), _mm_setzero_si128()));
+
+        const __m128 vx = _mm_loadu_ps(&store.velocityX[i]);
+        const __m128 vy = _mm_loadu_ps(&store.velocityY[i]);
+        const __m128 px = _mm_loadu_ps(&store.positionX[i]);
+        const __m128 py = _mm_loadu_ps(&store.positionY[i]);
+        const __m128 energy = _mm_loadu_ps(&store.energy[i]);
+
+        const __m128 movedX = _mm_add_ps(px, _mm_mul_ps(_mm_mul_ps(vx, dt), scale));
+        const __m128 movedY = _mm_add_ps(py, _mm_mul_ps(_mm_mul_ps(vy, dt), scale));
+        const __m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)));
+        const __m128 spent = _mm_sub_ps(energy, _mm_mul_ps(_mm_mul_ps(speed, dt), cost));
+
+        _mm_storeu_ps(&store.positionX[i], Select4(mask, movedX, px));
+        _mm_storeu_ps(&store.positionY[i], Select4(mask, movedY, py));
+        _mm_storeu_ps(&store.energy[i], Select4(mask, spent, energy));
+    }
+    IntegrateScalar(store, i, end, deltaTime);
+}
+
+ECOSYSTEM_TARGET_SSE2 void CollectDeathsSSE2(const EntityStore& store, size_t begin, size_t end,
+                                             LifeCycleCommands& commands) {
+    const __m128 zero = _mm_setzero_ps();
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const __m128 energy = _mm_loadu_ps(&store.energy[i]);
+        const __m128 starving = _mm_cmple_ps(energy, zero);
+        const __m128 tooOld = _mm_cmpge_ps(_mm_loadu_ps(&store.age[i]), _mm_loadu_ps(&store.maxAge[i]));
+        const __m128 alive = _mm_castsi128_ps(_mm_cmpgt_epi32(LoadBytes4(&store.alive[i]), _mm_setzero_si128()));
+        const int dying = _mm_movemask_ps(_mm_and_ps(alive, _mm_or_ps(starving, tooOld)));
+        if (dying == 0) continue;       // Cas courant : personne ne meurt dans ce groupe
+        const int starvingBits = _mm_movemask_ps(starving);
+        for (int lane = 0; lane < 4; ++lane) {
+            if (dying & (1 << lane)) {
+                commands.deaths.push_back({i + lane, (starvingBits & (1 << lane)) != 0});
+            }
+        }
+    }
+    CollectDeathsScalar(store, i, end, commands);
+}
+
+// 🚀 AVX2 : 8 entités par itération
+
+// Huit octets (type ou alive) étendus en entiers 32 bits
+ECOSYSTEM_TARGET_AVX2 inline __m256i LoadBytes8(const void* source) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(static_cast<const __m128i*>(source)));
+}
+
+// Table par type dans un registre : une permutation remplace le switch
+static_assert(SpeciesCount <= 8, "Une permutation AVX2 indexe au plus 8 espèces");
+
+ECOSYSTEM_TARGET_AVX2 inline __m256 TypeTable8(const std::array<float, SpeciesCount>& table) {
+    float lanes[8] = {};
+    std::memcpy(lanes, table.data(), sizeof(float) * SpeciesCount);
+    return _mm256_loadu_ps(lanes);
+}
+
+ECOSYSTEM_TARGET_AVX2 void ConsumeEnergyAVX2(EntityStore& store, size_t begin, size_t end, float deltaTime,
+                                              const std::array<float, SpeciesCount>& drainPerSecond) {
+    const __m256 table = TypeTable8(drainPerSecond);
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m256 drain = _mm256_permutevar8x32_ps(table, LoadBytes8(&store.type[i]));
+        const __m256 alive = _mm256_cvtepi32_ps(LoadBytes8(&store.alive[i]));
+        const __m256 energy = _mm256_loadu_ps(&store.energy[i]);
+        _mm256_storeu_ps(&store.energy[i], _mm256_sub_ps(energy, _mm256_mul_ps(_mm256_mul_ps(drain, dt), alive)));
+    }
+    ConsumeEnergyScalar(store, i, end, deltaTime, drainPerSecond);
+}
+
+ECOSYSTEM_TARGET_AVX2 void AgeAVX2(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    const __m256 increment = _mm256_set1_ps(deltaTime * LifeCycleKernels::AgingRate);
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m256 alive = _mm256_cvtepi32_ps(LoadBytes8(&store.alive[i]));
+        const __m256 age = _mm256_loadu_ps(&store.age[i]);
+        _mm256_storeu_ps(&store.age[i], _mm256_add_ps(age, _mm256_mul_ps(increment, alive)));
+    }
+    AgeScalar(store, i, end, deltaTime);
+}
+
+ECOSYSTEM_TARGET_AVX2 void IntegrateAVX2(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 scale = _mm256_set1_ps(LifeCycleKernels::MovementScale);
+    const __m256 cost = _mm256_set1_ps(LifeCycleKernels::MovementEnergyCost);
+    int mobileLanes[8] = {};
+    for (size_t type = 0; type < SpeciesCount; ++type) mobileLanes[type] = LifeCycleKernels::IsMobile[type];
+    const __m256i mobileTable = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mobileLanes));
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m256i mobile = _mm256_permutevar8x32_epi32(mobileTable, LoadBytes8(&store.type[i]));
+        const __m256i alive = LoadBytes8(&store.alive[i]);
+        const __m256 mask = _mm256_castsi256_ps(
+            _mm256_cmpgt_epi32(_mm256_and_si256(mobile, alive), _mm256_setzero_si256()));
+
+        const __m256 vx = _mm256_loadu_ps(&store.velocityX[i]);
+        const __m256 vy = _mm256_loadu_ps(&store.velocityY[i]);
+        const __m256 px = _mm256_loadu_ps(&store.positionX[i]);
+        const __m256 py = _mm256_loadu_ps(&store.positionY[i]);
+        const __m256 energy = _mm256_loadu_ps(&store.energy[i]);
+
+        const __m256 movedX = _mm256_add_ps(px, _mm256_mul_ps(_mm256_mul_ps(vx, dt), scale));
+        const __m256 movedY = _mm256_add_ps(py, _mm256_mul_ps(_mm256_mul_ps(vy, dt), scale));
+        const __m256 speed = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)));
+        const __m256 spent = _mm256_sub_ps(energy, _mm256_mul_ps(_mm256_mul_ps(speed, dt), cost));
+
+        // Les entités immobiles ou mortes sont recopiées telles quelles
+        _mm256_storeu_ps(&store.positionX[i], _mm256_blendv_ps(px, movedX, mask));
+        _mm256_storeu_ps(&store.positionY[i], _mm256_blendv_ps(py, movedY, mask));
+        _mm256_storeu_ps(&store.energy[i], _mm256_blendv_ps(energy, spent, mask));
+    }
+    IntegrateScalar(store, i, end, deltaTime);
+}
+
+ECOSYSTEM_TARGET_AVX2 void CollectDeathsAVX2(const EntityStore& store, size_t begin, size_t end,
+                                             LifeCycleCommands& commands) {
+    const __m256 zero = _mm256_setzero_ps();
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m256 starving = _mm256_cmp_ps(_mm256_loadu_ps(&store.energy[i]), zero, _CMP_LE_OQ);
+        const __m256 tooOld = _mm256_cmp_ps(_mm256_loadu_ps(&store.age[i]), _mm256_loadu_ps(&store.maxAge[i]),
+                                            _CMP_GE_OQ);
+        const __m256 alive = _mm256_castsi256_ps(
+            _mm256_cmpgt_epi32(LoadBytes8(&store.alive[i]), _mm256_setzero_si256()));
+        const int dying = _mm256_movemask_ps(_mm256_and_ps(alive, _mm256_or_ps(starving, tooOld)));
+        if (dying == 0) continue;       // Cas courant : personne ne meurt dans ce groupe
+        const int starvingBits = _mm256_movemask_ps(starving);
+        for (int lane = 0; lane < 8; ++lane) {
+            if (dying & (1 << lane)) {
+                commands.deaths.push_back({i + lane, (starvingBits & (1 << lane)) != 0});
+            }
+        }
+    }
+    CollectDeathsScalar(store, i, end, commands);
+}
+
+// Détection CPUID : AVX2 exige aussi que le système sauvegarde les registres YMM
+bool CpuSupportsAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int registers[4];
+    __cpuid(registers, 0);
+    if (registers[0] < 7) return false;
+    __cpuid(registers, 1);
+    const bool osSavesYmm = (registers[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+    const bool avx = (registers[2] & (1 << 28)) != 0;
+    __cpuidex(registers, 7, 0);
+    return osSavesYmm && avx && (registers[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // ECOSYSTEM_X86_SIMD
+
+// 🧭 JEU D'INSTRUCTIONS ACTIF (choisi une fois, modifiable pour les mesures)
+std::atomic<LifeCycleKernels::InstructionSet>& ActiveInstructionSet() {
+    static std::atomic<LifeCycleKernels::InstructionSet> active(LifeCycleKernels::Detect());
+    return active;
+}
+
+} // namespace
+
+// ⚙ AIGUILLAGE VERS LA VARIANTE ACTIVE
+void LifeCycleKernels::ConsumeEnergy(EntityStore& store, size_t begin, size_t end, float deltaTime,
+                                     const std::array<float, SpeciesCount>& drainPerSecond) {
+    switch (GetActive()) {
+#ifdef ECOSYSTEM_X86_SIMD
+        case InstructionSet::AVX2: ConsumeEnergyAVX2(store, begin, end, deltaTime, drainPerSecond); return;
+        case InstructionSet::SSE2: ConsumeEnergySSE2(store, begin, end, deltaTime, drainPerSecond); return;
+#endif
+        default: ConsumeEnergyScalar(store, begin, end, deltaTime, drainPerSecond); return;
+    }
+}
+
+void LifeCycleKernels::Age(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    switch (GetActive()) {
+#ifdef ECOSYSTEM_X86_SIMD
+        case InstructionSet::AVX2: AgeAVX2(store, begin, end, deltaTime); return;
+        case InstructionSet::SSE2: AgeSSE2(store, begin, end, deltaTime); return;
+#endif
+        default: AgeScalar(store, begin, end, deltaTime); return;
+    }
+}
+
+void LifeCycleKernels::Integrate(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    switch (GetActive()) {
+#ifdef ECOSYSTEM_X86_SIMD
+        case InstructionSet::AVX2: IntegrateAVX2(store, begin, end, deltaTime); return;
+        case InstructionSet::SSE2: IntegrateSSE2(store, begin, end, deltaTime); return;
+#endif
+        default: IntegrateScalar(store, begin, end, deltaTime); return;
+    }
+}
+
+void LifeCycleKernels::CollectDeaths(const EntityStore& store, size_t begin, size_t end, LifeCycleCommands& commands) {
+    switch (GetActive()) {
+#ifdef ECOSYSTEM_X86_SIMD
+        case InstructionSet::AVX2: CollectDeathsAVX2(store, begin, end, commands); return;
+        case InstructionSet::SSE2: CollectDeathsSSE2(store, begin, end, commands); return;
+#endif
+        default: CollectDeathsScalar(store, begin, end, commands); return;
+    }
+}
+
+// 🔍 DÉTECTION
+LifeCycleKernels::InstructionSet LifeCycleKernels::Detect() {
+#ifdef ECOSYSTEM_X86_SIMD
+    if (CpuSupportsAVX2()) return InstructionSet::AVX2;
+#if defined(__x86_64__) || defined(_M_X64)
+    return InstructionSet::SSE2;        // Toujours présent en x86-64
+#else
+    return __builtin_cpu_supports("sse2") ? InstructionSet::SSE2 : InstructionSet::Scalar;
+#endif
+#else
+    return InstructionSet::Scalar;
+#endif
+}
+
+LifeCycleKernels::InstructionSet LifeCycleKernels::GetActive() {
+    return ActiveInstructionSet().load(std::memory_order_relaxed);
+}
+
+bool LifeCycleKernels::SetActive(InstructionSet instructionSet) {
+    if (static_cast<uint8_t>(instructionSet) > static_cast<uint8_t>(Detect())) return false;
+    ActiveInstructionSet().store(instructionSet, std::memory_order_relaxed);
+    return true;
+}
+
+const char* LifeCycleKernels::GetName(InstructionSet instructionSet) {
+    switch (instructionSet) {
+        case InstructionSet::AVX2: return "AVX2";
+        case InstructionSet::SSE2: return "SSE2";
+        default: return "scalaire";
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,150 @@
+#include "Core/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🌐 INSTANCE UNIQUE
+Logger& Logger::Instance() {
+    static Logger instance;
+    return instance;
+}
+
+// 🏗 CONSTRUCTEUR : chaque case attend le producteur de même numéro
+Logger::Logger()
+    : mSlots(std::make_unique<Slot[]>(Capacity)),
+      mEnqueuePosition(0), mDequeuePosition(0), mWritten(0), mDropped(0), mStopping(false)
+{
+    for (size_t i = 0; i < Capacity; ++i) {
+        mSlots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    mWriter = std::thread(&Logger::WriterLoop, this);
+}
+
+// 🗑 DESTRUCTEUR
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mStopping = true;
+    }
+    mWakeCondition.notify_one();
+    mWriter.join();
+
+    uint64_t dropped = GetDroppedCount();
+    if (dropped > 0) {
+        std::cerr << "⚠ Journal: " << dropped << " lignes perdues (anneau plein)" << std::endl;
+    }
+}
+
+// 📥 DÉPÔT SANS VERROU (plusieurs producteurs)
+void Logger::Push(LogLevel level, const char* text, size_t length) {
+    size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &mSlots[position & (Capacity - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0) {
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // Anneau plein : la simulation n'attend jamais le journal
+            mDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    length = std::min(length, MaxMessageLength);
+    slot->level = level;
+    slot->length = static_cast<uint8_t>(length);
+    std::memcpy(slot->text, text, length);
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    // Réveil du thread de fond s'il dort (notify sans verrou : au pire, il se réveille au délai)
+    mWakeCondition.notify_one();
+}
+
+// ⏳ ATTENTE DE L'ÉCRITURE DE TOUT CE QUI A ÉTÉ DÉPOSÉ
+// Une ligne perdue ne prend pas de numéro : mEnqueuePosition ne compte que les lignes
+// acceptées, toutes écrites dans l'ordre des numéros (mWritten suit mDequeuePosition)
+void Logger::Flush() {
+    const size_t target = mEnqueuePosition.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(mWakeMutex);
+    mWakeCondition.notify_one();
+    mFlushedCondition.wait_for(lock, std::chrono::seconds(2), [this, target] {
+        return mWritten.load(std::memory_order_acquire) >= target;
+    });
+}
+
+// 🔁 THREAD DE FOND
+void Logger::WriterLoop() {
+    while (true) {
+        bool wroteAny = false;
+        while (WriteOne()) {
+            wroteAny = true;
+        }
+        if (wroteAny) {
+            std::cout.flush();
+            std::lock_guard<std::mutex> lock(mWakeMutex);
+            mFlushedCondition.notify_all();
+        }
+
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+        if (mStopping) {
+            lock.unlock();
+            while (WriteOne()) {}
+            std::cout.flush();
+            return;
+        }
+        mWakeCondition.wait_for(lock, std::chrono::milliseconds(20));
+    }
+}
+
+// 📤 ÉCRITURE D'UNE LIGNE (consommateur unique)
+bool Logger::WriteOne() {
+    Slot& slot = mSlots[mDequeuePosition & (Capacity - 1)];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != mDequeuePosition + 1) return false;
+
+    std::ostream& output = (slot.level >= LogLevel::Warning) ? std::cerr : std::cout;
+    output.write(slot.text, slot.length);
+    output.put('\n');
+
+    slot.sequence.store(mDequeuePosition + Capacity, std::memory_order_release);
+    ++mDequeuePosition;
+    mWritten.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+// ✍ COMPOSITION D'UNE LIGNE
+void LogLine::Append(const char* text, size_t length) {
+    size_t available = Logger::MaxMessageLength - mLength;
+    length = std::min(length, available);
+    std::memcpy(mBuffer + mLength, text, length);
+    mLength += length;
+}
+
+LogLine& LogLine::operator<<(const char* text) {
+    Append(text, std::strlen(text));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(double value) {
+    // Même rendu que std::cout par défaut (6 chiffres significatifs)
+    char digits[32];
+    int length = std::snprintf(digits, sizeof(digits), "%g", value);
+    if (length > 0) {
+        Append(digits, std::min(static_cast<size_t>(length), sizeof(digits) - 1));
+    }
+    return *this;
+}
+
+} // namespace Core
+} // namespace Ecosystem
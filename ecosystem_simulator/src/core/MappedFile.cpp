@@ -0,0 +1,112 @@
+#include "Core/MappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+#ifdef _WIN32
+MappedFile::MappedFile() : mData(nullptr), mSize(0), mFileHandle(nullptr), mMappingHandle(nullptr) {}
+#else
+MappedFile::MappedFile() : mData(nullptr), mSize(0) {}
+#endif
+
+// 🗑 DESTRUCTEUR
+MappedFile::~MappedFile() {
+    Close();
+}
+
+#ifdef _WIN32
+
+// 📂 PROJECTION (Windows)
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mFileHandle = file;
+    mMappingHandle = mapping;
+    mData = static_cast<const uint8_t*>(view);
+    mSize = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+// 🧹 LIBÉRATION (Windows)
+void MappedFile::Close() {
+    if (mData) UnmapViewOfFile(mData);
+    if (mMappingHandle) CloseHandle(static_cast<HANDLE>(mMappingHandle));
+    if (mFileHandle) CloseHandle(static_cast<HANDLE>(mFileHandle));
+    mData = nullptr;
+    mSize = 0;
+    mFileHandle = nullptr;
+    mMappingHandle = nullptr;
+}
+
+#else
+
+// 📂 PROJECTION (POSIX)
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) return false;
+
+    struct stat status;
+    if (::fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+        ::close(descriptor);
+        return false;
+    }
+    const size_t fileSize = static_cast<size_t>(status.st_size);
+    void* view = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // La projection reste valide après fermeture du descripteur
+    ::close(descriptor);
+    if (view == MAP_FAILED) return false;
+
+    // Lecture séquentielle des colonnes : lecture anticipée agressive
+    ::madvise(view, fileSize, MADV_SEQUENTIAL);
+    mData = static_cast<const uint8_t*>(view);
+    mSize = fileSize;
+    return true;
+}
+
+// 🧹 LIBÉRATION (POSIX)
+void MappedFile::Close() {
+    if (mData) {
+        ::munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+}
+
+#endif
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,121 @@
+#include "Core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+Profiler::Profiler() : mTickCount(0), mCsv(nullptr) {
+    Reset();
+}
+
+// 🗑 DESTRUCTEUR
+Profiler::~Profiler() {
+    CloseCsv();
+}
+
+// ♻ REMISE À ZÉRO DES FENÊTRES (le fichier CSV reste ouvert)
+void Profiler::Reset() {
+    mSampleCount.fill(0);
+    mNextSample.fill(0);
+    mLastMs.fill(0.0);
+    mPendingMs.fill(0.0);
+}
+
+// 📥 UNE MESURE
+void Profiler::Record(ProfilePhase phase, int64_t nanoseconds) {
+    const size_t index = Index(phase);
+    const double ms = static_cast<double>(nanoseconds) * 1e-6;
+
+    mSamples[index][mNextSample[index]] = static_cast<float>(ms);
+    mNextSample[index] = (mNextSample[index] + 1) % WindowSize;
+    mSampleCount[index] = std::min<uint32_t>(mSampleCount[index] + 1, WindowSize);
+    mLastMs[index] = ms;
+    mPendingMs[index] += ms;
+
+    // Le tick complet est mesuré en dernier : ses phases sont toutes connues
+    if (phase == ProfilePhase::Tick) {
+        CommitTick();
+    }
+}
+
+// 📝 FIN DE TICK : ligne CSV puis cumul remis à zéro
+void Profiler::CommitTick() {
+    if (mCsv) {
+        std::fprintf(mCsv, "%llu", static_cast<unsigned long long>(mTickCount));
+        for (double ms : mPendingMs) {
+            std::fprintf(mCsv, ",%.4f", ms);
+        }
+        std::fputc('\n', mCsv);
+    }
+    mPendingMs.fill(0.0);
+    ++mTickCount;
+}
+
+// 📊 RÉSUMÉ SUR LA FENÊTRE
+Profiler::Summary Profiler::GetSummary(ProfilePhase phase) const {
+    const size_t index = Index(phase);
+    const uint32_t count = mSampleCount[index];
+    Summary summary{0.0, 0.0, 0.0, mLastMs[index], count};
+    if (count == 0) return summary;
+
+    std::array<float, WindowSize> sorted;
+    std::copy(mSamples[index].begin(), mSamples[index].begin() + count, sorted.begin());
+    double total = 0.0;
+    for (uint32_t i = 0; i < count; ++i) {
+        total += sorted[i];
+    }
+    // p99 : rang le plus proche (avec 256 mesures, la troisième plus lente)
+    const uint32_t rank = static_cast<uint32_t>(std::ceil(0.99 * count)) - 1;
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.begin() + count);
+
+    summary.minimumMs = *std::min_element(sorted.begin(), sorted.begin() + count);
+    summary.averageMs = total / count;
+    summary.p99Ms = sorted[rank];
+    return summary;
+}
+
+// 📂 EXPORT CSV
+bool Profiler::OpenCsv(const std::string& path) {
+    if (!Enabled) return false;
+    CloseCsv();
+    mCsv = std::fopen(path.c_str(), "w");
+    if (!mCsv) return false;
+    // Tampon large : une écriture disque toutes les quelques centaines de ticks
+    std::setvbuf(mCsv, nullptr, _IOFBF, 1 << 16);
+
+    std::fputs("tick", mCsv);
+    for (size_t i = 0; i < PhaseCount; ++i) {
+        std::fprintf(mCsv, ",%s_ms", GetName(static_cast<ProfilePhase>(i)));
+    }
+    std::fputc('\n', mCsv);
+    return true;
+}
+
+void Profiler::CloseCsv() {
+    if (mCsv) {
+        std::fclose(mCsv);
+        mCsv = nullptr;
+    }
+}
+
+// 🏷 NOMS (colonnes CSV et superposition, ASCII pour la police de débogage SDL)
+const char* Profiler::GetName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::RemoveDeadEntities: return "remove_dead";
+        case ProfilePhase::UpdateEntities: return "update_entities";
+        case ProfilePhase::SpatialIndex: return "spatial_index";
+        case ProfilePhase::Behaviors: return "behaviors";
+        case ProfilePhase::Eating: return "eating";
+        case ProfilePhase::Reproduction: return "reproduction";
+        case ProfilePhase::PlantGrowth: return "plant_growth";
+        case ProfilePhase::Statistics: return "statistics";
+        case ProfilePhase::Tick: return "tick";
+        case ProfilePhase::Render: return "render";
+        default: return "?";
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,57 @@
+#include "Core/RenderFrame.h"
+
+namespace Ecosystem {
+namespace Core {
+
+// 📸 COPIE DE L'ÉTAT DESSINÉ (zone demandée seulement)
+void RenderFrame::Capture(const Ecosystem& ecosystem, const Region& area) {
+    const EntityStore& store = ecosystem.GetEntities();
+    positionX.clear();
+    positionY.clear();
+    previousPositionX.clear();
+    previousPositionY.clear();
+    size.clear();
+    energyRatio.clear();
+    color.clear();
+    type.clear();
+
+    auto copyEntity = [&](size_t i) {
+        if (!store.alive[i]) return;
+        positionX.push_back(store.positionX[i]);
+        positionY.push_back(store.positionY[i]);
+        previousPositionX.push_back(store.previousPositionX[i]);
+        previousPositionY.push_back(store.previousPositionY[i]);
+        size.push_back(store.size[i]);
+        energyRatio.push_back(store.energy[i] / store.maxEnergy[i]);
+        color.push_back(store.color[i]);
+        type.push_back(store.type[i]);
+    };
+
+    // 1. Entités indexées : requête sur la grille du dernier tick (les fantômes des
+    // tranches voisines ont un indice négatif et ne sont pas dessinés)
+    ecosystem.GetEntityGrid().QueryRect(area.minX, area.minY, area.maxX, area.maxY, SpatialGrid::AllTags,
+                                        [&](const SpatialGrid::Item& item) {
+        if (item.index >= 0) copyEntity(static_cast<size_t>(item.index));
+    });
+
+    // 2. Entités nées depuis : peu nombreuses, test direct
+    for (size_t index : ecosystem.GetUnindexedEntities()) {
+        const float x = store.positionX[index];
+        const float y = store.positionY[index];
+        if (x < area.minX || x > area.maxX || y < area.minY || y > area.maxY) continue;
+        copyEntity(index);
+    }
+
+    food.clear();
+    ecosystem.GetFood().QueryRect(area.minX, area.minY, area.maxX, area.maxY,
+                                  [&](const Food& item) { food.push_back(item); });
+
+    region = area;
+    worldWidth = ecosystem.GetWorldWidth();
+    worldHeight = ecosystem.GetWorldHeight();
+    tick = static_cast<uint32_t>(ecosystem.GetDayCycle());
+    entityCount = ecosystem.GetEntityCount();
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,261 @@
+#include "Core/ReplayLog.h"
+#include "Core/Logger.h"
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏷 MOTS-CLÉS DES ÉVÉNEMENTS (ordre de ReplayEventType)
+static const char* const EventNames[] = {
+    "initialize", "food", "load", "pause", "speed", "checkpoint", "end"
+};
+
+static bool ParseEventType(const std::string& name, ReplayEventType& type) {
+    for (size_t i = 0; i < sizeof(EventNames) / sizeof(EventNames[0]); ++i) {
+        if (name == EventNames[i]) {
+            type = static_cast<ReplayEventType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Flottants écrits avec 9 chiffres significatifs : relus au bit près
+static bool ParseFloat(std::istream& in, float& value) {
+    std::string token;
+    if (!(in >> token)) return false;
+    char* end = nullptr;
+    value = std::strtof(token.c_str(), &end);
+    return end != token.c_str() && *end == '\0';
+}
+
+static bool ParseHash(std::istream& in, uint64_t& hash) {
+    std::string token;
+    if (!(in >> token)) return false;
+    char* end = nullptr;
+    hash = std::strtoull(token.c_str(), &end, 16);
+    return end != token.c_str() && *end == '\0';
+}
+
+// 📂 LECTURE D'UN JOURNAL
+bool ReplayLog::Load(const std::string& path, ReplayLog& log, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = "fichier illisible";
+        return false;
+    }
+
+    // 1. En-tête
+    std::string magic;
+    int version = 0;
+    if (!(file >> magic >> version) || magic != "ECOREPLAY") {
+        error = "pas un journal de rejeu";
+        return false;
+    }
+    if (version != Version) {
+        error = "version " + std::to_string(version) + " non prise en charge";
+        return false;
+    }
+    ReplayHeader header;
+    std::string key;
+    bool headerValid = (file >> key) && key == "world" && ParseFloat(file, header.worldWidth) &&
+                       ParseFloat(file, header.worldHeight) && (file >> header.maxEntities);
+    headerValid = headerValid && (file >> key) && key == "seed" && (file >> header.seed);
+    headerValid = headerValid && (file >> key) && key == "dt" && ParseFloat(file, header.tickDuration);
+    headerValid = headerValid && (file >> key) && key == "checkpoint-interval" && (file >> header.checkpointInterval);
+    if (!headerValid || header.worldWidth <= 0.0f || header.worldHeight <= 0.0f || header.tickDuration <= 0.0f) {
+        error = "en-tête incomplet";
+        return false;
+    }
+
+    // 2. Événements, une ligne chacun
+    std::vector<ReplayEvent> events;
+    std::string line;
+    std::getline(file, line);           // Fin de la ligne d'en-tête
+    size_t lineNumber = 5;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        // Chaque ligne est écrite d'un bloc avec son saut de ligne : sans lui, l'écriture a été coupée
+        if (file.eof()) {
+            ECO_LOG_WARNING("⚠ Journal de rejeu tronqué ligne " << lineNumber << " (" << path << ")");
+            break;
+        }
+        if (line.empty()) continue;
+        std::istringstream in(line);
+        ReplayEvent event;
+        std::string name;
+        bool valid = (in >> event.tick >> name) && ParseEventType(name, event.type);
+        if (valid) {
+            switch (event.type) {
+                case ReplayEventType::Initialize:
+                    valid = static_cast<bool>(in >> event.values[0] >> event.values[1] >> event.values[2]);
+                    break;
+                case ReplayEventType::SpawnFood:
+                case ReplayEventType::Pause:
+                    valid = static_cast<bool>(in >> event.values[0]);
+                    break;
+                case ReplayEventType::LoadSnapshot:
+                    // Reste de la ligne : le chemin peut contenir des espaces
+                    in >> std::ws;
+                    std::getline(in, event.path);
+                    valid = !event.path.empty();
+                    break;
+                case ReplayEventType::TimeScale:
+                    valid = ParseFloat(in, event.timeScale);
+                    break;
+                case ReplayEventType::Checkpoint:
+                case ReplayEventType::End:
+                    valid = ParseHash(in, event.hash);
+                    break;
+            }
+        }
+        if (!valid || (!events.empty() && event.tick < events.back().tick) ||
+            (!events.empty() && events.back().type == ReplayEventType::End)) {
+            error = "ligne " + std::to_string(lineNumber) + " invalide";
+            return false;
+        }
+        events.push_back(std::move(event));
+    }
+
+    log.header = header;
+    log.events = std::move(events);
+    return true;
+}
+
+// 🏗 CONSTRUCTEUR
+ReplayRecorder::ReplayRecorder()
+    : mFile(nullptr),
+      mTick(0),
+      mCheckpointInterval(0) {}
+
+// 🗑 DESTRUCTEUR
+ReplayRecorder::~ReplayRecorder() {
+    if (mFile) std::fclose(mFile);
+}
+
+// 📂 OUVERTURE : en-tête du monde de départ
+bool ReplayRecorder::Open(const std::string& path, const ReplayHeader& header) {
+    if (mFile) std::fclose(mFile);
+    mFile = std::fopen(path.c_str(), "w");
+    if (!mFile) return false;
+
+    std::fprintf(mFile, "ECOREPLAY %d\nworld %.9g %.9g %d\nseed %" PRIu64 "\ndt %.9g\ncheckpoint-interval %" PRIu32 "\n",
+                 ReplayLog::Version, header.worldWidth, header.worldHeight, header.maxEntities,
+                 header.seed, header.tickDuration, header.checkpointInterval);
+    std::fflush(mFile);
+    mTick = 0;
+    mCheckpointInterval = header.checkpointInterval;
+    ECO_LOG_INFO("⏺ Enregistrement du rejeu dans " << path << " (graine " << header.seed << ")");
+    return true;
+}
+
+// 🧹 FERMETURE : empreinte finale
+void ReplayRecorder::Close(const Ecosystem& ecosystem) {
+    if (!mFile) return;
+    ReplayEvent event;
+    event.type = ReplayEventType::End;
+    event.hash = ecosystem.ComputeStateHash();
+    Write(event);
+    const bool ok = std::fclose(mFile) == 0;
+    mFile = nullptr;
+    if (ok) {
+        ECO_LOG_INFO("⏹ Rejeu enregistré: " << mTick << " ticks");
+    } else {
+        ECO_LOG_ERROR("❌ Écriture du journal de rejeu incomplète (" << mTick << " ticks)");
+    }
+}
+
+// 📥 ÉVÉNEMENTS
+void ReplayRecorder::RecordInitialize(int herbivores, int carnivores, int plants, const Ecosystem& ecosystem) {
+    if (!mFile) return;
+    ReplayEvent event;
+    event.type = ReplayEventType::Initialize;
+    event.values[0] = herbivores;
+    event.values[1] = carnivores;
+    event.values[2] = plants;
+    Write(event);
+
+    ReplayEvent checkpoint;
+    checkpoint.hash = ecosystem.ComputeStateHash();
+    Write(checkpoint);
+}
+
+void ReplayRecorder::RecordLoadSnapshot(const std::string& path, const Ecosystem& ecosystem) {
+    if (!mFile) return;
+    ReplayEvent event;
+    event.type = ReplayEventType::LoadSnapshot;
+    event.path = path;
+    Write(event);
+
+    // Le fichier peut changer avant le rejeu : l'écart se voit dès ce point de contrôle
+    ReplayEvent checkpoint;
+    checkpoint.hash = ecosystem.ComputeStateHash();
+    Write(checkpoint);
+}
+
+void ReplayRecorder::RecordSpawnFood(int count) {
+    if (!mFile) return;
+    ReplayEvent event;
+    event.type = ReplayEventType::SpawnFood;
+    event.values[0] = count;
+    Write(event);
+}
+
+void ReplayRecorder::RecordPause(bool paused) {
+    if (!mFile) return;
+    ReplayEvent event;
+    event.type = ReplayEventType::Pause;
+    event.values[0] = paused ? 1 : 0;
+    Write(event);
+}
+
+void ReplayRecorder::RecordTimeScale(float timeScale) {
+    if (!mFile) return;
+    ReplayEvent event;
+    event.type = ReplayEventType::TimeScale;
+    event.timeScale = timeScale;
+    Write(event);
+}
+
+// ⏱ FIN D'UN TICK
+void ReplayRecorder::EndTick(const Ecosystem& ecosystem) {
+    if (!mFile) return;
+    ++mTick;
+    if (mCheckpointInterval > 0 && mTick % mCheckpointInterval == 0) {
+        ReplayEvent checkpoint;
+        checkpoint.hash = ecosystem.ComputeStateHash();
+        Write(checkpoint);
+    }
+}
+
+// ✏ UNE LIGNE, vidée aussitôt
+void ReplayRecorder::Write(const ReplayEvent& event) {
+    std::fprintf(mFile, "%" PRIu64 " %s", mTick, EventNames[static_cast<size_t>(event.type)]);
+    switch (event.type) {
+        case ReplayEventType::Initialize:
+            std::fprintf(mFile, " %d %d %d\n", event.values[0], event.values[1], event.values[2]);
+            break;
+        case ReplayEventType::SpawnFood:
+        case ReplayEventType::Pause:
+            std::fprintf(mFile, " %d\n", event.values[0]);
+            break;
+        case ReplayEventType::LoadSnapshot:
+            std::fprintf(mFile, " %s\n", event.path.c_str());
+            break;
+        case ReplayEventType::TimeScale:
+            std::fprintf(mFile, " %.9g\n", event.timeScale);
+            break;
+        case ReplayEventType::Checkpoint:
+        case ReplayEventType::End:
+            std::fprintf(mFile, " %016" PRIx64 "\n", event.hash);
+            break;
+    }
+    std::fflush(mFile);
+}
+
+} // namespace Core
+} // namespace Ecosystem
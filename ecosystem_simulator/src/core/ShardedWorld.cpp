@@ -0,0 +1,494 @@
+#include "Core/ShardedWorld.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char** environ;
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+// 📨 MESSAGES (même binaire des deux côtés : structures copiées telles quelles)
+enum class ShardMessageType : uint32_t {
+    Setup,              // Coordinateur → éclat : ShardSetup
+    Tick,               // Coordinateur → éclat : arrivants puis fantômes, un Update à faire
+    Report,             // Éclat → coordinateur : sortants puis entités de bord, statistiques
+    Stop
+};
+
+struct ShardMessageHeader {
+    ShardMessageType type;
+    uint32_t recordCount;               // EntityRecord qui suivent (arrivants ou sortants)
+    uint32_t ghostCount;                // GhostEntity qui suivent
+    int32_t entityCount;                // Report : entités vivantes après les départs
+    uint64_t tick;
+    Ecosystem::Statistics statistics;   // Report seulement
+};
+
+struct ShardSetup {
+    float worldWidth;
+    float worldHeight;
+    int32_t columns;
+    int32_t rows;
+    int32_t maxEntities;                // Part de l'éclat
+    int32_t herbivores;
+    int32_t carnivores;
+    int32_t plants;
+    int32_t threadCount;
+    float tickDuration;
+    float ghostMargin;
+    uint64_t seed;                      // Même graine partout : un migrant garde ses flux aléatoires
+    WorldDomain domain;
+    SpeciesParameters species[SpeciesCount];    // Ordre de EntityType
+};
+
+// 🗺 DÉCOUPAGE
+int ShardLayout::ColumnOf(float x) const {
+    const int column = static_cast<int>(std::floor(x / worldWidth * columns));
+    return std::clamp(column, 0, columns - 1);
+}
+
+int ShardLayout::RowOf(float y) const {
+    const int row = static_cast<int>(std::floor(y / worldHeight * rows));
+    return std::clamp(row, 0, rows - 1);
+}
+
+uint32_t ShardLayout::OwnerOf(Vector2D position) const {
+    return static_cast<uint32_t>(RowOf(position.y) * columns + ColumnOf(position.x));
+}
+
+// Bords calculés comme ColumnOf : le rectangle de l'éclat est exactement ce qu'il possède
+WorldDomain ShardLayout::GetDomain(uint32_t shard) const {
+    const int column = static_cast<int>(shard) % columns;
+    const int row = static_cast<int>(shard) / columns;
+    return {worldWidth * column / columns, worldHeight * row / rows,
+            worldWidth * (column + 1) / columns, worldHeight * (row + 1) / rows, shard};
+}
+
+// 🍰 PART D'UN ÉCLAT : arrondis cumulés, la somme des parts redonne le total
+static int ShareOf(int total, const ShardLayout& layout, uint32_t shard) {
+    const double worldArea = static_cast<double>(layout.worldWidth) * layout.worldHeight;
+    double before = 0.0;
+    for (uint32_t other = 0; other < shard; ++other) {
+        const WorldDomain domain = layout.GetDomain(other);
+        before += static_cast<double>(domain.maxX - domain.minX) * (domain.maxY - domain.minY);
+    }
+    const WorldDomain domain = layout.GetDomain(shard);
+    const double after = before + static_cast<double>(domain.maxX - domain.minX) * (domain.maxY - domain.minY);
+    return static_cast<int>(std::floor(total * after / worldArea + 0.5)) -
+           static_cast<int>(std::floor(total * before / worldArea + 0.5));
+}
+
+#ifndef _WIN32
+
+// 🔌 ÉCHANGES SUR SOCKET (messages complets, sans SIGPIPE si l'autre côté a disparu)
+static bool WriteAll(int socket, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        const ssize_t written = ::send(socket, bytes, size, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return false;
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+static bool ReadAll(int socket, void* data, size_t size) {
+    char* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        const ssize_t received = ::recv(socket, bytes, size, 0);
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) return false;
+        bytes += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+}
+
+template <typename T>
+static bool WriteArray(int socket, const std::vector<T>& items) {
+    return items.empty() || WriteAll(socket, items.data(), items.size() * sizeof(T));
+}
+
+template <typename T>
+static bool ReadArray(int socket, std::vector<T>& items, size_t count) {
+    items.resize(count);
+    return count == 0 || ReadAll(socket, items.data(), count * sizeof(T));
+}
+
+static bool WriteMessage(int socket, ShardMessageHeader header, const std::vector<EntityRecord>& records,
+                         const std::vector<GhostEntity>& ghosts) {
+    header.recordCount = static_cast<uint32_t>(records.size());
+    header.ghostCount = static_cast<uint32_t>(ghosts.size());
+    return WriteAll(socket, &header, sizeof(header)) && WriteArray(socket, records) && WriteArray(socket, ghosts);
+}
+
+static bool ReadMessage(int socket, ShardMessageHeader& header, std::vector<EntityRecord>& records,
+                        std::vector<GhostEntity>& ghosts) {
+    return ReadAll(socket, &header, sizeof(header)) && ReadArray(socket, records, header.recordCount) &&
+           ReadArray(socket, ghosts, header.ghostCount);
+}
+
+// 📤 FIN DE TICK D'UN ÉCLAT : départs, entités de bord, statistiques
+static bool SendReport(int socket, Ecosystem& ecosystem, const ShardLayout& layout, float ghostMargin,
+                       uint64_t tick, std::vector<EntityRecord>& leaving, std::vector<GhostEntity>& border) {
+    const WorldDomain& domain = ecosystem.GetDomain();
+    const EntityStore& entities = ecosystem.GetEntities();
+    leaving.clear();
+    border.clear();
+    for (size_t i = 0; i < entities.Size(); ++i) {
+        if (!entities.alive[i]) continue;
+        const Vector2D position = entities.GetPosition(i);
+        if (layout.OwnerOf(position) != domain.shard) {
+            leaving.push_back(ecosystem.ReleaseEntity(i));
+            continue;
+        }
+        // Bande intérieure le long des bords partagés avec un voisin
+        if ((domain.minX > 0.0f && position.x < domain.minX + ghostMargin) ||
+            (domain.maxX < layout.worldWidth && position.x >= domain.maxX - ghostMargin) ||
+            (domain.minY > 0.0f && position.y < domain.minY + ghostMargin) ||
+            (domain.maxY < layout.worldHeight && position.y >= domain.maxY - ghostMargin)) {
+            border.push_back({position, entities.type[i]});
+        }
+    }
+
+    // Populations recomptées après les départs (Update les avait comptés avant)
+    ShardMessageHeader header{};
+    header.type = ShardMessageType::Report;
+    header.tick = tick;
+    header.statistics = ecosystem.GetStatistics();
+    header.statistics.totalHerbivores = static_cast<int>(entities.LiveCount(EntityType::HERBIVORE));
+    header.statistics.totalCarnivores = static_cast<int>(entities.LiveCount(EntityType::CARNIVORE));
+    header.statistics.totalPlants = static_cast<int>(entities.LiveCount(EntityType::PLANT));
+    header.statistics.totalFood = ecosystem.GetFoodCount();
+    header.entityCount = static_cast<int32_t>(entities.LiveCount());
+    return WriteMessage(socket, header, leaving, border);
+}
+
+// 🧩 PROCESSUS D'UN ÉCLAT
+int ShardCoordinator::RunWorker(int socket) {
+    ShardMessageHeader header{};
+    ShardSetup setup{};
+    if (!ReadAll(socket, &header, sizeof(header)) || header.type != ShardMessageType::Setup ||
+        !ReadAll(socket, &setup, sizeof(setup))) {
+        ECO_LOG_ERROR("❌ Éclat: configuration illisible");
+        return -1;
+    }
+
+    ShardLayout layout;
+    layout.worldWidth = setup.worldWidth;
+    layout.worldHeight = setup.worldHeight;
+    layout.columns = setup.columns;
+    layout.rows = setup.rows;
+    SpeciesTable species;
+    std::copy(setup.species, setup.species + SpeciesCount, species.species.begin());
+
+    Ecosystem ecosystem(setup.worldWidth, setup.worldHeight, setup.maxEntities, setup.threadCount);
+    ecosystem.SetSeed(setup.seed);
+    ecosystem.SetSpecies(species);
+    ecosystem.SetDomain(setup.domain);
+    ecosystem.Initialize(setup.herbivores, setup.carnivores, setup.plants);
+
+    // Tampons réutilisés d'un tick à l'autre
+    std::vector<EntityRecord> records;
+    std::vector<GhostEntity> ghosts;
+    std::vector<EntityRecord> leaving;
+    std::vector<GhostEntity> border;
+    if (!SendReport(socket, ecosystem, layout, setup.ghostMargin, 0, leaving, border)) return -1;
+
+    while (ReadMessage(socket, header, records, ghosts)) {
+        if (header.type == ShardMessageType::Stop) return 0;
+        for (const EntityRecord& record : records) {
+            ecosystem.AdoptEntity(record);
+        }
+        ecosystem.SetGhosts(ghosts);
+        ecosystem.Update(setup.tickDuration);
+        if (!SendReport(socket, ecosystem, layout, setup.ghostMargin, header.tick, leaving, border)) return -1;
+    }
+    ECO_LOG_ERROR("❌ Éclat " << setup.domain.shard << ": coordinateur perdu");
+    return -1;
+}
+
+// 🚀 LANCEMENT DES ÉCLATS : une paire de sockets et un processus chacun
+bool ShardCoordinator::Launch() {
+    // Le binaire courant, relancé en mode éclat (rien n'est hérité de l'état du coordinateur)
+    const std::string executable = ::access("/proc/self/exe", X_OK) == 0 ? "/proc/self/exe" : mConfig.executablePath;
+    for (int shard = 0; shard < mLayout.GetShardCount(); ++shard) {
+        int sockets[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) != 0) {
+            ECO_LOG_ERROR("❌ socketpair impossible pour l'éclat " << shard);
+            return false;
+        }
+        // Seule l'extrémité de l'éclat traverse l'exec
+        ::fcntl(sockets[1], F_SETFD, 0);
+        const std::string socketText = std::to_string(sockets[1]);
+        char* arguments[] = {const_cast<char*>(executable.c_str()), const_cast<char*>("--shard-worker"),
+                             const_cast<char*>(socketText.c_str()), nullptr};
+        pid_t process = 0;
+        const int error = ::posix_spawnp(&process, executable.c_str(), nullptr, nullptr, arguments, environ);
+        ::close(sockets[1]);
+        if (error != 0) {
+            ::close(sockets[0]);
+            ECO_LOG_ERROR("❌ Lancement de l'éclat " << shard << " impossible (" << executable << ")");
+            return false;
+        }
+        mSockets.push_back(sockets[0]);
+        mProcesses.push_back(process);
+    }
+    return true;
+}
+
+// 🛑 ARRÊT : message Stop, puis attente de chaque processus
+void ShardCoordinator::Stop() {
+    ShardMessageHeader stop{};
+    stop.type = ShardMessageType::Stop;
+    for (int socket : mSockets) {
+        WriteAll(socket, &stop, sizeof(stop));
+        ::close(socket);
+    }
+    for (int process : mProcesses) {
+        int status = 0;
+        ::waitpid(process, &status, 0);
+    }
+    mSockets.clear();
+    mProcesses.clear();
+}
+
+#else
+
+// Windows : pas de socketpair ni de posix_spawn, le mode réparti n'est pas disponible
+int ShardCoordinator::RunWorker(int) {
+    return -1;
+}
+
+bool ShardCoordinator::Launch() {
+    ECO_LOG_ERROR("❌ Monde réparti non disponible sous Windows");
+    return false;
+}
+
+void ShardCoordinator::Stop() {}
+
+#endif
+
+// 🏗 CONSTRUCTEUR
+ShardCoordinator::ShardCoordinator(const ShardedConfig& config)
+    : mConfig(config)
+{
+    mLayout.worldWidth = config.world.worldWidth;
+    mLayout.worldHeight = config.world.worldHeight;
+    mLayout.columns = std::max(1, config.columns);
+    mLayout.rows = std::max(1, config.rows);
+}
+
+// 🗑 DESTRUCTEUR
+ShardCoordinator::~ShardCoordinator() {
+    Stop();
+}
+
+// 🚀 BOUCLE EN PHASE : tous les éclats avancent du même tick
+ShardCoordinator::Result ShardCoordinator::Run() {
+    Result result{};
+    HeadlessRunner::Result& world = result.world;
+    world.firstMismatchTick = -1;
+    world.herbivoreExtinctionTick = -1;
+    world.carnivoreExtinctionTick = -1;
+    world.minimumPopulation = std::numeric_limits<int>::max();
+    const int shardCount = mLayout.GetShardCount();
+    result.shardEntities.assign(shardCount, 0);
+
+    if (!Launch()) {
+        result.failed = true;
+        return result;
+    }
+#ifndef _WIN32
+    // 1. Configuration de chaque éclat : sa part du monde et de la population
+    const HeadlessConfig& config = mConfig.world;
+    uint64_t seed = config.seed;
+    if (seed == 0) {
+        std::random_device entropy;
+        seed = (static_cast<uint64_t>(entropy()) << 32) | entropy();
+    }
+    for (int shard = 0; shard < shardCount; ++shard) {
+        ShardMessageHeader header{};
+        header.type = ShardMessageType::Setup;
+        ShardSetup setup{};
+        setup.worldWidth = config.worldWidth;
+        setup.worldHeight = config.worldHeight;
+        setup.columns = mLayout.columns;
+        setup.rows = mLayout.rows;
+        setup.maxEntities = std::max(1, ShareOf(config.maxEntities, mLayout, shard));
+        setup.herbivores = ShareOf(config.initialHerbivores, mLayout, shard);
+        setup.carnivores = ShareOf(config.initialCarnivores, mLayout, shard);
+        setup.plants = ShareOf(config.initialPlants, mLayout, shard);
+        setup.threadCount = config.threadCount;
+        setup.tickDuration = config.tickDuration;
+        setup.ghostMargin = mConfig.ghostMargin;
+        setup.seed = seed;
+        setup.domain = mLayout.GetDomain(shard);
+        std::copy(config.species.species.begin(), config.species.species.end(), setup.species);
+        if (!WriteAll(mSockets[shard], &header, sizeof(header)) || !WriteAll(mSockets[shard], &setup, sizeof(setup))) {
+            result.failed = true;
+            return result;
+        }
+    }
+    ECO_LOG_INFO("🧩 Monde réparti: " << mLayout.columns << "x" << mLayout.rows << " éclats, graine " << seed
+                 << ", zone fantôme " << mConfig.ghostMargin);
+
+    long long tickLimit = config.maxTicks;
+    if (tickLimit <= 0) {
+        const float seconds = config.maxSimulatedTime > 0.0f ? config.maxSimulatedTime : 60.0f;
+        tickLimit = static_cast<long long>(seconds / config.tickDuration);
+    }
+
+    // 2. Ticks : envoi des arrivants et des fantômes, puis collecte et routage des rapports
+    std::vector<std::vector<EntityRecord>> arrivals(shardCount);
+    std::vector<std::vector<GhostEntity>> ghosts(shardCount);
+    std::vector<EntityRecord> leaving;
+    std::vector<GhostEntity> border;
+    const float margin = mConfig.ghostMargin;
+    auto start = std::chrono::steady_clock::now();
+
+    for (long long tick = 0; ; ++tick) {
+        if (tick > 0) {
+            for (int shard = 0; shard < shardCount; ++shard) {
+                ShardMessageHeader header{};
+                header.type = ShardMessageType::Tick;
+                header.tick = static_cast<uint64_t>(tick);
+                if (!WriteMessage(mSockets[shard], header, arrivals[shard], ghosts[shard])) {
+                    ECO_LOG_ERROR("❌ Éclat " << shard << " injoignable au tick " << tick);
+                    result.failed = true;
+                    break;
+                }
+                result.ghostsSent += static_cast<long long>(ghosts[shard].size());
+                arrivals[shard].clear();
+                ghosts[shard].clear();
+            }
+            if (result.failed) break;
+        }
+
+        // Rapports dans l'ordre des éclats : routage déterministe
+        Ecosystem::Statistics total{};
+        int population = 0;
+        for (int shard = 0; shard < shardCount; ++shard) {
+            ShardMessageHeader report{};
+            if (!ReadMessage(mSockets[shard], report, leaving, border) || report.type != ShardMessageType::Report) {
+                ECO_LOG_ERROR("❌ Éclat " << shard << " perdu au tick " << tick);
+                result.failed = true;
+                break;
+            }
+            const Ecosystem::Statistics& stats = report.statistics;
+            total.totalHerbivores += stats.totalHerbivores;
+            total.totalCarnivores += stats.totalCarnivores;
+            total.totalPlants += stats.totalPlants;
+            total.totalFood += stats.totalFood;
+            total.deathsToday += stats.deathsToday;
+            total.birthsToday += stats.birthsToday;
+            total.day = std::max(total.day, stats.day);
+            total.totalDeaths += stats.totalDeaths;
+            total.totalBirths += stats.totalBirths;
+            population += report.entityCount;
+            result.shardEntities[shard] = report.entityCount;
+
+            for (const EntityRecord& record : leaving) {
+                arrivals[mLayout.OwnerOf(Vector2D(record.positionX, record.positionY))].push_back(record);
+            }
+            result.migrations += static_cast<long long>(leaving.size());
+            // Entité de bord : fantôme de chaque voisin dont la zone élargie la contient
+            for (const GhostEntity& ghost : border) {
+                const int firstColumn = mLayout.ColumnOf(ghost.position.x - margin);
+                const int lastColumn = mLayout.ColumnOf(ghost.position.x + margin);
+                const int firstRow = mLayout.RowOf(ghost.position.y - margin);
+                const int lastRow = mLayout.RowOf(ghost.position.y + margin);
+                for (int row = firstRow; row <= lastRow; ++row) {
+                    for (int column = firstColumn; column <= lastColumn; ++column) {
+                        const int neighbour = row * mLayout.columns + column;
+                        if (neighbour != shard) ghosts[neighbour].push_back(ghost);
+                    }
+                }
+            }
+        }
+        if (result.failed) break;
+
+        // Population du monde entier (migrants en transit compris)
+        for (const auto& shardArrivals : arrivals) {
+            population += static_cast<int>(shardArrivals.size());
+            for (const EntityRecord& record : shardArrivals) {
+                int* count = record.type == EntityType::HERBIVORE ? &total.totalHerbivores
+                           : record.type == EntityType::CARNIVORE ? &total.totalCarnivores : &total.totalPlants;
+                ++*count;
+            }
+        }
+        world.finalStatistics = total;
+        world.finalEntityCount = population;
+        world.minimumPopulation = std::min(world.minimumPopulation, population);
+        world.maximumPopulation = std::max(world.maximumPopulation, population);
+        if (tick > 0 && total.totalHerbivores == 0 && world.herbivoreExtinctionTick < 0) {
+            world.herbivoreExtinctionTick = tick;
+        }
+        if (tick > 0 && total.totalCarnivores == 0 && world.carnivoreExtinctionTick < 0) {
+            world.carnivoreExtinctionTick = tick;
+        }
+        world.ticks = tick;
+        if (tick >= tickLimit) break;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    world.wallSeconds = elapsed.count();
+    world.simulatedSeconds = world.ticks * static_cast<double>(config.tickDuration);
+    world.ticksPerSecond = world.wallSeconds > 0.0 ? world.ticks / world.wallSeconds : 0.0;
+    world.minimumPopulation = std::min(world.minimumPopulation, world.maximumPopulation);
+#endif
+    Stop();
+    return result;
+}
+
+// 📊 RAPPORT : monde entier, puis répartition entre éclats
+void ShardCoordinator::PrintReport(const Result& result) {
+    const HeadlessRunner::Result& world = result.world;
+    const Ecosystem::Statistics& stats = world.finalStatistics;
+    Logger::Instance().Flush();
+    std::cout << "📊 Monde réparti terminé" << (result.failed ? " (interrompu)" : "") << std::endl;
+    std::cout << "   Ticks: " << world.ticks
+              << " (" << world.simulatedSeconds << " s simulées en " << world.wallSeconds << " s)" << std::endl;
+    std::cout << "   Débit: " << world.ticksPerSecond << " ticks/s" << std::endl;
+    std::cout << "   Entités: " << world.finalEntityCount
+              << " - Herbivores: " << stats.totalHerbivores
+              << ", Carnivores: " << stats.totalCarnivores
+              << ", Plantes: " << stats.totalPlants
+              << ", Nourriture: " << stats.totalFood
+              << ", Naissances: " << stats.totalBirths
+              << ", Morts: " << stats.totalDeaths << std::endl;
+    std::cout << "   Population: " << world.minimumPopulation << " à " << world.maximumPopulation << " entités";
+    if (world.herbivoreExtinctionTick >= 0) {
+        std::cout << ", herbivores éteints au tick " << world.herbivoreExtinctionTick;
+    }
+    if (world.carnivoreExtinctionTick >= 0) {
+        std::cout << ", carnivores éteints au tick " << world.carnivoreExtinctionTick;
+    }
+    std::cout << std::endl;
+    std::cout << "   Éclats:";
+    for (size_t shard = 0; shard < result.shardEntities.size(); ++shard) {
+        std::cout << " [" << shard << "] " << result.shardEntities[shard];
+    }
+    std::cout << std::endl;
+    std::cout << "   Échanges: " << result.migrations << " migrations, "
+              << (world.ticks > 0 ? static_cast<double>(result.ghostsSent) / world.ticks : 0.0)
+              << " fantômes par tick" << std::endl;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,115 @@
+#include "Core/Snapshot.h"
+#include <cstdio>
+#include <cstring>
+
+namespace Ecosystem {
+namespace Core {
+
+constexpr char SnapshotHeader::Magic[8];
+
+static size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// ✍ ÉCRITURE EN UNE PASSE : en-tête, table, puis colonnes alignées
+bool SnapshotWriter::WriteTo(const std::string& path) {
+    std::memcpy(mHeader.magic, SnapshotHeader::Magic, sizeof(mHeader.magic));
+    mHeader.version = SnapshotHeader::Version;
+    mHeader.headerSize = sizeof(SnapshotHeader);
+    mHeader.byteOrder = SnapshotHeader::ByteOrderMark;
+    mHeader.sectionCount = static_cast<uint32_t>(mSections.size());
+
+    size_t offset = AlignUp(sizeof(SnapshotHeader) + mSections.size() * sizeof(SnapshotSectionEntry), Alignment);
+    for (PendingSection& section : mSections) {
+        section.entry.offset = offset;
+        offset = AlignUp(offset + section.entry.elementSize * section.entry.count, Alignment);
+    }
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+
+    static const char padding[Alignment] = {};
+    size_t written = 0;
+    auto write = [&](const void* data, size_t bytes) {
+        if (bytes > 0 && std::fwrite(data, 1, bytes, file) != bytes) return false;
+        written += bytes;
+        return true;
+    };
+
+    bool ok = write(&mHeader, sizeof(mHeader));
+    for (const PendingSection& section : mSections) {
+        ok = ok && write(&section.entry, sizeof(section.entry));
+    }
+    for (const PendingSection& section : mSections) {
+        ok = ok && write(padding, section.entry.offset - written);
+        ok = ok && write(section.data, section.entry.elementSize * section.entry.count);
+    }
+    ok = ok && write(padding, offset - written);
+    ok = (std::fclose(file) == 0) && ok;
+    return ok;
+}
+
+// 📖 OUVERTURE ET VALIDATION
+bool SnapshotReader::Open(const std::string& path, std::string& error) {
+    mHeader = nullptr;
+    mSections = nullptr;
+    if (!mFile.Open(path)) {
+        error = "fichier illisible";
+        return false;
+    }
+
+    const size_t fileSize = mFile.GetSize();
+    const SnapshotHeader* header = reinterpret_cast<const SnapshotHeader*>(mFile.GetData());
+    if (fileSize < sizeof(SnapshotHeader) ||
+        std::memcmp(header->magic, SnapshotHeader::Magic, sizeof(header->magic)) != 0) {
+        error = "pas un instantané d'écosystème";
+        return false;
+    }
+    if (header->byteOrder != SnapshotHeader::ByteOrderMark) {
+        error = "ordre des octets différent de cette machine";
+        return false;
+    }
+    if (header->version != SnapshotHeader::Version || header->headerSize != sizeof(SnapshotHeader)) {
+        error = "version " + std::to_string(header->version) + " non prise en charge (attendue "
+              + std::to_string(SnapshotHeader::Version) + ")";
+        return false;
+    }
+
+    const size_t tableEnd = sizeof(SnapshotHeader) + header->sectionCount * sizeof(SnapshotSectionEntry);
+    if (tableEnd > fileSize) {
+        error = "table des colonnes tronquée";
+        return false;
+    }
+    const SnapshotSectionEntry* sections =
+        reinterpret_cast<const SnapshotSectionEntry*>(mFile.GetData() + sizeof(SnapshotHeader));
+    for (uint32_t i = 0; i < header->sectionCount; ++i) {
+        const SnapshotSectionEntry& entry = sections[i];
+        // Bornes vérifiées sans débordement : offset + taille <= fichier
+        if (entry.offset < tableEnd || entry.offset > fileSize || entry.offset % SnapshotWriter::Alignment != 0 ||
+            entry.elementSize == 0 || entry.count > (fileSize - entry.offset) / entry.elementSize) {
+            error = "colonne " + std::to_string(entry.id) + " hors du fichier";
+            return false;
+        }
+    }
+
+    mHeader = header;
+    mSections = sections;
+    return true;
+}
+
+// 🔍 RECHERCHE D'UNE COLONNE
+const SnapshotSectionEntry* SnapshotReader::FindEntry(SnapshotSection id) const {
+    if (!mHeader) return nullptr;
+    for (uint32_t i = 0; i < mHeader->sectionCount; ++i) {
+        if (mSections[i].id == static_cast<uint32_t>(id)) return &mSections[i];
+    }
+    return nullptr;
+}
+
+uint64_t SnapshotReader::GetSectionCount(SnapshotSection id) const {
+    const SnapshotSectionEntry* entry = FindEntry(id);
+    return entry ? entry->count : 0;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,82 @@
+#include "Core/SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+SpatialGrid::SpatialGrid(float worldWidth, float worldHeight, float cellSize)
+    : mCellSize(cellSize), mInverseCellSize(1.0f / cellSize), mColumns(1), mRows(1)
+{
+    Resize(worldWidth, worldHeight, cellSize);
+}
+
+// 📐 DIMENSIONNEMENT DE LA GRILLE
+void SpatialGrid::Resize(float worldWidth, float worldHeight, float cellSize) {
+    mCellSize = cellSize;
+    mInverseCellSize = 1.0f / cellSize;
+    mColumns = std::max(1, static_cast<int>(std::ceil(worldWidth * mInverseCellSize)));
+    mRows = std::max(1, static_cast<int>(std::ceil(worldHeight * mInverseCellSize)));
+    Clear();
+}
+
+// 🧹 VIDAGE
+void SpatialGrid::Clear() {
+    mPending.clear();
+    mItems.clear();
+    mCellStart.assign(mColumns * mRows + 1, 0);
+}
+
+// ➕ INSERTION (prise en compte au prochain Build)
+void SpatialGrid::Insert(Vector2D position, int index, int tag) {
+    mPending.push_back({position, index, tag});
+}
+
+// ⚙ CONSTRUCTION PAR TRI PAR COMPTAGE
+void SpatialGrid::Build() {
+    const int cellCount = mColumns * mRows;
+    mCellStart.assign(cellCount + 1, 0);
+    mCellOfPending.resize(mPending.size());
+
+    // 1. Comptage des éléments par cellule
+    for (size_t i = 0; i < mPending.size(); ++i) {
+        const Item& item = mPending[i];
+        const int cell = CellY(item.position.y) * mColumns + CellX(item.position.x);
+        mCellOfPending[i] = cell;
+        mCellStart[cell + 1]++;
+    }
+
+    // 2. Somme préfixe : début de chaque cellule
+    for (int cell = 0; cell < cellCount; ++cell) {
+        mCellStart[cell + 1] += mCellStart[cell];
+    }
+
+    // 3. Placement stable (l'ordre d'insertion est conservé dans chaque cellule)
+    mItems.resize(mPending.size());
+    mCellCursor.assign(mCellStart.begin(), mCellStart.end() - 1);
+    for (size_t i = 0; i < mPending.size(); ++i) {
+        mItems[mCellCursor[mCellOfPending[i]]++] = mPending[i];
+    }
+
+    mPending.clear();
+}
+
+// 🔢 COORDONNÉES DE CELLULE (les positions hors du monde sont ramenées au bord)
+int SpatialGrid::CellX(float x) const {
+    const int cell = static_cast<int>(std::floor(x * mInverseCellSize));
+    return std::clamp(cell, 0, mColumns - 1);
+}
+
+int SpatialGrid::CellY(float y) const {
+    const int cell = static_cast<int>(std::floor(y * mInverseCellSize));
+    return std::clamp(cell, 0, mRows - 1);
+}
+
+// 🎯 PLUS PROCHE VOISIN SANS FILTRE SUPPLÉMENTAIRE
+const SpatialGrid::Item* SpatialGrid::FindNearest(Vector2D center, float radius, uint32_t tagMask) const {
+    return FindNearest(center, radius, tagMask, [](const Item&) { return true; });
+}
+
+} // namespace Core
+} // namespace Ecosystem
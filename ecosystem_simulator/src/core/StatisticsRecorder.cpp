@@ -0,0 +1,314 @@
+#include "Core/StatisticsRecorder.h"
+#include "Core/Logger.h"
+#include "Core/MappedFile.h"
+#include <cstring>
+
+namespace Ecosystem {
+namespace Core {
+
+constexpr char StatisticsFileHeader::Magic[8];
+
+// 🏷 COLONNES (ordre de Record)
+static const StatisticsColumnInfo Columns[StatisticsRecorder::ColumnCount] = {
+    {"herbivores", StatisticsColumnType::Int32, 0},
+    {"carnivores", StatisticsColumnType::Int32, 0},
+    {"plants", StatisticsColumnType::Int32, 0},
+    {"food", StatisticsColumnType::Int32, 0},
+    {"births_today", StatisticsColumnType::Int32, 0},
+    {"deaths_today", StatisticsColumnType::Int32, 0},
+    {"entities", StatisticsColumnType::Int32, 0},
+    {"herbivore_energy", StatisticsColumnType::Float32, 0},
+    {"carnivore_energy", StatisticsColumnType::Float32, 0},
+    {"plant_energy", StatisticsColumnType::Float32, 0},
+    {"herbivore_age", StatisticsColumnType::Float32, 0},
+    {"carnivore_age", StatisticsColumnType::Float32, 0},
+    {"plant_age", StatisticsColumnType::Float32, 0},
+};
+
+const StatisticsColumnInfo& StatisticsRecorder::GetColumn(size_t column) {
+    return Columns[column];
+}
+
+// 🏗 CONSTRUCTEUR
+StatisticsRecorder::StatisticsRecorder()
+    : mOpen(false),
+      mFile(nullptr),
+      mCsv(nullptr),
+      mCurrent(nullptr),
+      mNextTick(0),
+      mRecordedTicks(0),
+      mStalls(0),
+      mWriteFailed(false),
+      mStopping(false) {}
+
+// 🗑 DESTRUCTEUR
+StatisticsRecorder::~StatisticsRecorder() {
+    Close();
+}
+
+// 📂 OUVERTURE : en-tête, réserve de blocs, thread d'écriture
+bool StatisticsRecorder::Open(const std::string& path, const std::string& csvPath) {
+    Close();
+    if (path.empty() && csvPath.empty()) return false;
+    if (!path.empty()) {
+        mFile = std::fopen(path.c_str(), "wb");
+        if (!mFile) return false;
+
+        StatisticsFileHeader header{};
+        std::memcpy(header.magic, StatisticsFileHeader::Magic, sizeof(header.magic));
+        header.version = StatisticsFileHeader::Version;
+        header.byteOrder = StatisticsFileHeader::ByteOrderMark;
+        header.columnCount = static_cast<uint32_t>(ColumnCount);
+        header.chunkCapacity = ChunkCapacity;
+        std::fwrite(&header, sizeof(header), 1, mFile);
+        std::fwrite(Columns, sizeof(StatisticsColumnInfo), ColumnCount, mFile);
+    }
+    if (!csvPath.empty()) {
+        mCsv = std::fopen(csvPath.c_str(), "w");
+        if (!mCsv) {
+            if (mFile) std::fclose(mFile);
+            mFile = nullptr;
+            return false;
+        }
+        std::setvbuf(mCsv, nullptr, _IOFBF, 1 << 16);
+        WriteCsvHeader(mCsv, Columns, ColumnCount);
+    }
+
+    // Toute la mémoire est prise ici : Record() n'alloue jamais
+    mReady.clear();
+    mReady.reserve(ChunkPoolSize);
+    mFree.clear();
+    mFree.reserve(ChunkPoolSize);
+    for (Chunk& chunk : mChunks) {
+        if (!chunk.values) {
+            chunk.values = std::make_unique<uint32_t[]>(ColumnCount * ChunkCapacity);
+        }
+        chunk.rowCount = 0;
+        chunk.firstTick = 0;
+        if (&chunk != &mChunks[0]) mFree.push_back(&chunk);
+    }
+    mCurrent = &mChunks[0];
+    mNextTick = 0;
+    mRecordedTicks = 0;
+    mStalls = 0;
+    mWriteFailed = false;
+    mStopping = false;
+    mWriter = std::thread(&StatisticsRecorder::WriterLoop, this);
+    mOpen = true;
+    return true;
+}
+
+// 🧹 FERMETURE : bloc partiel, vidage, bilan
+void StatisticsRecorder::Close() {
+    if (!mOpen) return;
+    if (mCurrent->rowCount > 0) {
+        Submit();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mReadyCondition.notify_one();
+    mWriter.join();
+
+    bool ok = !mWriteFailed;
+    if (mFile) ok = (std::fclose(mFile) == 0) && ok;
+    if (mCsv) ok = (std::fclose(mCsv) == 0) && ok;
+    mFile = nullptr;
+    mCsv = nullptr;
+    mOpen = false;
+
+    if (ok) {
+        ECO_LOG_INFO("📈 Statistiques: " << mRecordedTicks << " ticks écrits (" << mStalls
+                     << " attentes du disque)");
+    } else {
+        ECO_LOG_ERROR("❌ Écriture des statistiques incomplète (" << mRecordedTicks << " ticks)");
+    }
+}
+
+// 📥 UN TICK : une valeur par colonne dans le bloc courant
+void StatisticsRecorder::Record(uint64_t tick, const StatisticsSample& sample) {
+    if (!mOpen) return;
+    if (mCurrent->rowCount > 0 && tick != mNextTick) {
+        Submit();
+    }
+    if (mCurrent->rowCount == 0) {
+        mCurrent->firstTick = tick;
+    }
+
+    uint32_t* row = mCurrent->values.get() + mCurrent->rowCount;
+    size_t column = 0;
+    auto store = [&](auto value) {
+        static_assert(sizeof(value) == sizeof(uint32_t), "colonne de 4 octets");
+        std::memcpy(row + column * ChunkCapacity, &value, sizeof(value));
+        ++column;
+    };
+    store(sample.herbivores);
+    store(sample.carnivores);
+    store(sample.plants);
+    store(sample.food);
+    store(sample.birthsToday);
+    store(sample.deathsToday);
+    store(sample.entities);
+    for (float energy : sample.averageEnergy) store(energy);
+    for (float age : sample.averageAge) store(age);
+
+    ++mCurrent->rowCount;
+    mNextTick = tick + 1;
+    ++mRecordedTicks;
+    if (mCurrent->rowCount == ChunkCapacity) {
+        Submit();
+    }
+}
+
+// 📤 BLOC PLEIN VERS LE THREAD D'ÉCRITURE
+void StatisticsRecorder::Submit() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mReady.push_back(mCurrent);
+    mReadyCondition.notify_one();
+    if (mFree.empty()) {
+        ++mStalls;
+        mFreeCondition.wait(lock, [this] { return !mFree.empty(); });
+    }
+    mCurrent = mFree.back();
+    mFree.pop_back();
+    mCurrent->rowCount = 0;
+}
+
+// 🧵 THREAD D'ÉCRITURE : blocs dans l'ordre d'arrivée, disque hors du verrou
+void StatisticsRecorder::WriterLoop() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        mReadyCondition.wait(lock, [this] { return !mReady.empty() || mStopping; });
+        if (mReady.empty()) break;      // Arrêt demandé et tout est écrit
+
+        Chunk* chunk = mReady.front();
+        lock.unlock();
+        const bool ok = WriteChunk(*chunk);
+        lock.lock();
+
+        if (!ok) mWriteFailed = true;
+        mReady.erase(mReady.begin());
+        mFree.push_back(chunk);
+        mFreeCondition.notify_one();
+    }
+}
+
+bool StatisticsRecorder::WriteChunk(const Chunk& chunk) {
+    bool ok = true;
+    if (mFile) {
+        StatisticsChunkHeader header{chunk.rowCount, 0, chunk.firstTick};
+        ok = std::fwrite(&header, sizeof(header), 1, mFile) == 1;
+        for (size_t column = 0; column < ColumnCount; ++column) {
+            ok = ok && std::fwrite(chunk.values.get() + column * ChunkCapacity, sizeof(uint32_t),
+                                   chunk.rowCount, mFile) == chunk.rowCount;
+        }
+    }
+    if (mCsv) {
+        WriteCsvRows(mCsv, Columns, ColumnCount, chunk.firstTick, chunk.rowCount, chunk.values.get(), ChunkCapacity);
+        ok = ok && !std::ferror(mCsv);
+    }
+    return ok;
+}
+
+// 📝 CSV
+void StatisticsRecorder::WriteCsvHeader(FILE* csv, const StatisticsColumnInfo* columns, size_t columnCount) {
+    std::fputs("tick", csv);
+    for (size_t column = 0; column < columnCount; ++column) {
+        std::fprintf(csv, ",%.*s", static_cast<int>(sizeof(columns[column].name)), columns[column].name);
+    }
+    std::fputc('\n', csv);
+}
+
+void StatisticsRecorder::WriteCsvRows(FILE* csv, const StatisticsColumnInfo* columns, size_t columnCount,
+                                      uint64_t firstTick, uint32_t rowCount, const uint32_t* values,
+                                      size_t columnStride) {
+    for (uint32_t row = 0; row < rowCount; ++row) {
+        std::fprintf(csv, "%llu", static_cast<unsigned long long>(firstTick + row));
+        for (size_t column = 0; column < columnCount; ++column) {
+            const uint32_t bits = values[column * columnStride + row];
+            if (columns[column].type == StatisticsColumnType::Float32) {
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                std::fprintf(csv, ",%.6g", value);
+            } else {
+                int32_t value;
+                std::memcpy(&value, &bits, sizeof(value));
+                std::fprintf(csv, ",%d", value);
+            }
+        }
+        std::fputc('\n', csv);
+    }
+}
+
+// 🔄 CONVERSION : fichier projeté, colonnes lues sur place
+bool StatisticsRecorder::ExportCsv(const std::string& path, const std::string& csvPath, std::string& error) {
+    MappedFile file;
+    if (!file.Open(path)) {
+        error = "fichier illisible";
+        return false;
+    }
+    const uint8_t* data = file.GetData();
+    const size_t size = file.GetSize();
+
+    StatisticsFileHeader header;
+    if (size < sizeof(header)) {
+        error = "pas un fichier de statistiques";
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, StatisticsFileHeader::Magic, sizeof(header.magic)) != 0) {
+        error = "pas un fichier de statistiques";
+        return false;
+    }
+    if (header.byteOrder != StatisticsFileHeader::ByteOrderMark) {
+        error = "ordre des octets différent de cette machine";
+        return false;
+    }
+    if (header.version != StatisticsFileHeader::Version) {
+        error = "version " + std::to_string(header.version) + " non prise en charge";
+        return false;
+    }
+    const size_t columnTableEnd = sizeof(header) + size_t(header.columnCount) * sizeof(StatisticsColumnInfo);
+    if (header.columnCount == 0 || columnTableEnd > size) {
+        error = "table des colonnes tronquée";
+        return false;
+    }
+    const StatisticsColumnInfo* columns = reinterpret_cast<const StatisticsColumnInfo*>(data + sizeof(header));
+
+    FILE* csv = std::fopen(csvPath.c_str(), "w");
+    if (!csv) {
+        error = "impossible de créer " + csvPath;
+        return false;
+    }
+    std::setvbuf(csv, nullptr, _IOFBF, 1 << 16);
+    WriteCsvHeader(csv, columns, header.columnCount);
+
+    size_t offset = columnTableEnd;
+    uint64_t rows = 0;
+    while (offset + sizeof(StatisticsChunkHeader) <= size) {
+        StatisticsChunkHeader chunk;
+        std::memcpy(&chunk, data + offset, sizeof(chunk));
+        offset += sizeof(chunk);
+        const size_t bytes = size_t(chunk.rowCount) * header.columnCount * sizeof(uint32_t);
+        if (chunk.rowCount > header.chunkCapacity || bytes > size - offset) {
+            // Dernier bloc interrompu : les lignes précédentes restent exploitables
+            ECO_LOG_WARNING("⚠ " << path << ": bloc tronqué au tick " << chunk.firstTick << ", ignoré");
+            break;
+        }
+        WriteCsvRows(csv, columns, header.columnCount, chunk.firstTick, chunk.rowCount,
+                     reinterpret_cast<const uint32_t*>(data + offset), chunk.rowCount);
+        offset += bytes;
+        rows += chunk.rowCount;
+    }
+
+    if (std::fclose(csv) != 0) {
+        error = "écriture de " + csvPath + " incomplète";
+        return false;
+    }
+    ECO_LOG_INFO("📈 " << rows << " ticks convertis en CSV: " << csvPath);
+    return true;
+}
+
+} // namespace Core
+} // namespace Ecosystem
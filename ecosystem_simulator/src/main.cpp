@@ -1,24 +1,262 @@
+#include "Core/EnsembleRunner.h"
+#include "Core/HeadlessRunner.h"
+#include "Core/Logger.h"
+#include "Core/ReplayLog.h"
+#include "Core/ShardedWorld.h"
+#include "Core/StatisticsRecorder.h"
+#ifndef ECOSYSTEM_HEADLESS_ONLY
 #include "Core/GameEngine.h"
+#endif
 #include <iostream>
 #include <cstdlib>
-#include <ctime>
+#include <string>
+
+// 📋 AIDE EN LIGNE DE COMMANDE
+static void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [--headless] [options]" << std::endl;
+    std::cout << "  --headless            Simulation sans fenêtre, aussi vite que possible" << std::endl;
+    std::cout << "  --ticks N             Nombre de ticks à simuler (headless)" << std::endl;
+    std::cout << "  --time S              Temps simulé en secondes (headless)" << std::endl;
+    std::cout << "  --dt S                Durée d'un tick en secondes (défaut 1/60)" << std::endl;
+    std::cout << "  --world L H           Taille du monde (indépendante de la fenêtre)" << std::endl;
+    std::cout << "  --max-entities N      Population maximale" << std::endl;
+    std::cout << "  --population H C P    Herbivores, carnivores et plantes initiaux" << std::endl;
+    std::cout << "  --seed N              Graine du monde (résultats reproductibles)" << std::endl;
+    std::cout << "  --threads N           Threads de simulation (0 = tous les cœurs)" << std::endl;
+    std::cout << "  --profile-csv FICHIER Durée de chaque phase, une ligne par tick" << std::endl;
+    std::cout << "  --load-snapshot FICHIER  Reprend un monde sauvegardé (F5 en mode fenêtré)" << std::endl;
+    std::cout << "  --save-snapshot FICHIER  Sauvegarde le monde final (headless)" << std::endl;
+    std::cout << "  --stats FICHIER       Statistiques de chaque tick, en colonnes binaires" << std::endl;
+    std::cout << "  --stats-csv FICHIER   Les mêmes statistiques en CSV (avec ou sans --stats)" << std::endl;
+    std::cout << "  --stats-export STATS CSV  Convertit un fichier de --stats en CSV, puis quitte" << std::endl;
+    std::cout << "  --record FICHIER      Journal de rejeu : graine, entrées clavier, empreintes de l'état" << std::endl;
+    std::cout << "  --checkpoint-interval N  Ticks entre deux empreintes du journal (défaut 600)" << std::endl;
+    std::cout << "  --replay FICHIER      Rejoue un journal sans fenêtre et vérifie ses empreintes" << std::endl;
+    std::cout << "  --ensemble FICHIER    Balayage de paramètres : un monde par cœur (--threads), sans fenêtre" << std::endl;
+    std::cout << "  --ensemble-output CSV Table des résultats de l'ensemble (défaut : sortie standard)" << std::endl;
+    std::cout << "  --shards C L          Monde réparti en C x L éclats, un processus chacun (headless)" << std::endl;
+}
+
+// 🖥 LECTURE DES ARGUMENTS DU MODE HEADLESS
+static bool ParseArguments(int argc, char* argv[], bool& headless, bool& exportStatistics,
+                           std::string& replayPath, std::string& ensemblePath, std::string& ensembleOutputPath,
+                           Ecosystem::Core::ShardedConfig& sharded, Ecosystem::Core::HeadlessConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--headless") {
+            headless = true;
+        } else if (arg == "--ticks" && hasValue) {
+            config.maxTicks = std::atoll(argv[++i]);
+        } else if (arg == "--time" && hasValue) {
+            config.maxSimulatedTime = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--dt" && hasValue) {
+            config.tickDuration = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--world" && i + 2 < argc) {
+            config.worldWidth = static_cast<float>(std::atof(argv[++i]));
+            config.worldHeight = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--max-entities" && hasValue) {
+            config.maxEntities = std::atoi(argv[++i]);
+        } else if (arg == "--seed" && hasValue) {
+            config.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && hasValue) {
+            config.threadCount = std::atoi(argv[++i]);
+        } else if (arg == "--profile-csv" && hasValue) {
+            config.profileCsvPath = argv[++i];
+        } else if (arg == "--load-snapshot" && hasValue) {
+            config.loadSnapshotPath = argv[++i];
+        } else if (arg == "--save-snapshot" && hasValue) {
+            config.saveSnapshotPath = argv[++i];
+        } else if (arg == "--stats" && hasValue) {
+            config.statisticsPath = argv[++i];
+        } else if (arg == "--stats-csv" && hasValue) {
+            config.statisticsCsvPath = argv[++i];
+        } else if (arg == "--stats-export" && i + 2 < argc) {
+            exportStatistics = true;
+            config.statisticsPath = argv[++i];
+            config.statisticsCsvPath = argv[++i];
+        } else if (arg == "--record" && hasValue) {
+            config.recordPath = argv[++i];
+        } else if (arg == "--checkpoint-interval" && hasValue) {
+            config.checkpointInterval = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--replay" && hasValue) {
+            headless = true;
+            replayPath = argv[++i];
+        } else if (arg == "--ensemble" && hasValue) {
+            headless = true;
+            ensemblePath = argv[++i];
+        } else if (arg == "--ensemble-output" && hasValue) {
+            ensembleOutputPath = argv[++i];
+        } else if (arg == "--shards" && i + 2 < argc) {
+            headless = true;
+            sharded.columns = std::atoi(argv[++i]);
+            sharded.rows = std::atoi(argv[++i]);
+            if (sharded.columns < 1 || sharded.rows < 1) {
+                std::cerr << "❌ --shards attend deux nombres d'éclats strictement positifs" << std::endl;
+                return false;
+            }
+        } else if (arg == "--population" && i + 3 < argc) {
+            config.initialHerbivores = std::atoi(argv[++i]);
+            config.initialCarnivores = std::atoi(argv[++i]);
+            config.initialPlants = std::atoi(argv[++i]);
+        } else {
+            std::cerr << "❌ Argument inconnu ou incomplet: " << arg << std::endl;
+            return false;
+        }
+    }
+    if (config.worldWidth <= 0.0f || config.worldHeight <= 0.0f) {
+        std::cerr << "❌ --world attend deux dimensions strictement positives" << std::endl;
+        return false;
+    }
+    if (config.tickDuration <= 0.0f) {
+        std::cerr << "❌ --dt doit être strictement positif" << std::endl;
+        return false;
+    }
+    if (!replayPath.empty() && !config.loadSnapshotPath.empty()) {
+        std::cerr << "❌ --replay reprend le monde du journal : --load-snapshot n'a pas de sens" << std::endl;
+        return false;
+    }
+    const bool shardedWorld = sharded.columns * sharded.rows > 0;
+    if (shardedWorld && (!replayPath.empty() || !ensemblePath.empty() || !config.loadSnapshotPath.empty() ||
+                         !config.saveSnapshotPath.empty() || !config.recordPath.empty() ||
+                         !config.statisticsPath.empty() || !config.statisticsCsvPath.empty() ||
+                         !config.profileCsvPath.empty())) {
+        std::cerr << "❌ --shards : instantanés, rejeu, ensembles et enregistrements non pris en charge" << std::endl;
+        return false;
+    }
+    if (!ensemblePath.empty() && (!replayPath.empty() || !config.loadSnapshotPath.empty())) {
+        std::cerr << "❌ --ensemble part de mondes neufs : sans --replay ni --load-snapshot" << std::endl;
+        return false;
+    }
+    return true;
+}
 
 int main(int argc, char* argv[]) {
-    // 🎲 Initialisation de l'aléatoire
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    
+    // 🧩 Processus d'éclat lancé par un coordinateur (--shards) : tout vient de la socket
+    if (argc == 3 && std::string(argv[1]) == "--shard-worker") {
+        const int status = Ecosystem::Core::ShardCoordinator::RunWorker(std::atoi(argv[2]));
+        Ecosystem::Core::Logger::Instance().Flush();
+        return status;
+    }
+
+    // 🎲 Aucun aléatoire global : tout tirage dérive de la graine du monde (--seed ou entropie)
+    bool headless = false;
+    bool exportStatistics = false;
+    std::string replayPath;
+    std::string ensemblePath;
+    std::string ensembleOutputPath;
+    Ecosystem::Core::ShardedConfig sharded;
+    sharded.columns = 0;                // 0 = monde en un seul processus
+    sharded.rows = 0;
+    Ecosystem::Core::HeadlessConfig config;
+    if (!ParseArguments(argc, argv, headless, exportStatistics, replayPath, ensemblePath, ensembleOutputPath,
+                        sharded, config)) {
+        PrintUsage(argv[0]);
+        return -1;
+    }
+
+    // 📈 Conversion d'un enregistrement existant, sans simulation
+    if (exportStatistics) {
+        std::string error;
+        const bool exported = Ecosystem::Core::StatisticsRecorder::ExportCsv(config.statisticsPath,
+                                                                            config.statisticsCsvPath, error);
+        Ecosystem::Core::Logger::Instance().Flush();
+        if (!exported) {
+            std::cerr << "❌ Erreur: " << config.statisticsPath << ": " << error << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+#ifdef ECOSYSTEM_HEADLESS_ONLY
+    headless = true;
+#endif
+
+    // 🧩 Monde réparti : un processus par éclat, statistiques agrégées par ce processus
+    if (sharded.columns * sharded.rows > 0) {
+        sharded.world = config;
+        sharded.executablePath = argv[0];
+        Ecosystem::Core::ShardCoordinator coordinator(sharded);
+        const auto result = coordinator.Run();
+        Ecosystem::Core::ShardCoordinator::PrintReport(result);
+        return result.failed ? -1 : 0;
+    }
+
+    // 🧬 Ensemble : le balayage complète la configuration de la ligne de commande
+    if (!ensemblePath.empty()) {
+        Ecosystem::Core::SweepDescription sweep;
+        std::string error;
+        if (!Ecosystem::Core::SweepDescription::Load(ensemblePath, sweep, error)) {
+            Ecosystem::Core::Logger::Instance().Flush();
+            std::cerr << "❌ Erreur: " << ensemblePath << ": " << error << std::endl;
+            return -1;
+        }
+        Ecosystem::Core::EnsembleRunner ensemble(config, sweep);
+        ensemble.Run(config.threadCount);
+        ensemble.PrintSummary();
+        if (!ensemble.WriteTable(ensembleOutputPath)) {
+            std::cerr << "❌ Erreur: Impossible d'écrire " << ensembleOutputPath << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+    // 🎬 Rejeu : le monde, la graine et le pas viennent du journal
+    Ecosystem::Core::ReplayLog replay;
+    if (!replayPath.empty()) {
+        std::string error;
+        if (!Ecosystem::Core::ReplayLog::Load(replayPath, replay, error)) {
+            Ecosystem::Core::Logger::Instance().Flush();
+            std::cerr << "❌ Erreur: " << replayPath << ": " << error << std::endl;
+            return -1;
+        }
+        Ecosystem::Core::HeadlessRunner::ApplyReplayHeader(replay, config);
+    }
+
+    // 🖥 Mode headless : ni fenêtre, ni SDL
+    if (headless) {
+        Ecosystem::Core::HeadlessRunner runner(config, replayPath.empty() ? nullptr : &replay);
+        auto result = runner.Run();
+        if (result.snapshotFailed && result.ticks == 0 && replayPath.empty()) {
+            Ecosystem::Core::Logger::Instance().Flush();
+            std::cerr << "❌ Erreur: Impossible de reprendre " << config.loadSnapshotPath << std::endl;
+            return -1;
+        }
+        Ecosystem::Core::HeadlessRunner::PrintReport(result);
+        return (result.snapshotFailed || result.checkpointMismatches > 0) ? -1 : 0;
+    }
+
+#ifndef ECOSYSTEM_HEADLESS_ONLY
     std::cout << "🎮 Démarrage du Simulateur d'Écosystème" << std::endl;
     std::cout << "=======================================" << std::endl;
-    
+
     // 🏗 Création du moteur de jeu
-    Ecosystem::Core::GameEngine engine("Simulateur d'Écosystème Intelligent", 1200.0f, 800.0f);
-    
-    // ⚙️ Initialisation
+    Ecosystem::Core::GameEngine engine("Simulateur d'Écosystème Intelligent", 1200.0f, 800.0f,
+                                       config.worldWidth, config.worldHeight);
+
+    // ⚙️ Initialisation (journal ouvert avant : il note la graine puis le premier Initialize)
+    if (config.seed != 0) {
+        engine.SetSeed(config.seed);
+    }
+    if (!config.recordPath.empty()) {
+        engine.StartRecording(config.recordPath, config.checkpointInterval);
+    }
     if (!engine.Initialize()) {
         std::cerr << "❌ Erreur: Impossible d'initialiser le moteur de jeu" << std::endl;
         return -1;
     }
-    
+    if (!config.profileCsvPath.empty()) {
+        engine.StartProfileCsv(config.profileCsvPath);
+    }
+    if (!config.loadSnapshotPath.empty() && !engine.LoadSnapshot(config.loadSnapshotPath)) {
+        std::cerr << "❌ Erreur: Impossible de reprendre " << config.loadSnapshotPath << std::endl;
+        return -1;
+    }
+    if (!config.statisticsPath.empty() || !config.statisticsCsvPath.empty()) {
+        engine.StartStatistics(config.statisticsPath, config.statisticsCsvPath);
+    }
+
+    Ecosystem::Core::Logger::Instance().Flush();
     std::cout << "✅ Moteur initialisé avec succès" << std::endl;
     std::cout << "🎯 Lancement de la simulation..." << std::endl;
     std::cout << "=== CONTRÔLES ===" << std::endl;
@@ -26,14 +264,20 @@ int main(int argc, char* argv[]) {
     std::cout << "R: Reset simulation" << std::endl;
     std::cout << "F: Ajouter nourriture" << std::endl;
     std::cout << "FLÈCHES: Vitesse simulation" << std::endl;
+    std::cout << "MOLETTE / + -: Zoom" << std::endl;
+    std::cout << "GLISSER (souris): Déplacer la caméra" << std::endl;
+    std::cout << "C: Vue d'ensemble du monde" << std::endl;
+    std::cout << "P: Profilage par phase (min / moyenne / p99)" << std::endl;
+    std::cout << "F5 / F9: Sauvegarder / recharger le monde" << std::endl;
     std::cout << "ÉCHAP: Quitter" << std::endl;
-    
+
     // 🎮 Boucle principale
     engine.Run();
-    
+
     // 🛑 Arrêt propre
     engine.Shutdown();
-    
+
     std::cout << "👋 Simulation terminée. Au revoir !" << std::endl;
+#endif
     return 0;
-}
\ No newline at end of file
+}